@@ -111,6 +111,12 @@ public:
 protected:
   virtual Real computeValue() = 0;
 
+  /**
+   * Called once per element, before computeValue() is called at the quadrature points of an
+   * elemental variable.
+   */
+  virtual void precalculateValue();
+
   /// Subproblem this kernel is part of
   SubProblem & _subproblem;
   /// System this kernel is part of
@@ -41,8 +41,16 @@ public:
 protected:
   virtual Real computeValue();
 
+  /**
+   * Evaluates the function at the centroid of an element once, instead of at every quadrature point
+   */
+  virtual void precalculateValue();
+
   /// Function being used to compute the value of this kernel
   Function & _func;
+
+  /// The value of the function at the centroid of the current element
+  Real _elem_value;
 };
 
 #endif // FUNCTIONAUX_H
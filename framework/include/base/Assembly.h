@@ -294,6 +294,47 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Limit the memory used by the FE shape function cache.  Once the limit is reached the least recently
+   * used elements are evicted from the cache.
+   *
+   * @param max_memory The maximum number of bytes to use (0 for no limit).
+   */
+  void setFECacheMaxMemory(std::size_t max_memory) { _fe_cache_max_memory = max_memory; }
+
+  /**
+   * Number of reinitFE() calls that were served from the FE shape function cache
+   */
+  unsigned long int feCacheHits() const { return _fe_cache_hits; }
+
+  /**
+   * Number of reinitFE() calls (with caching on) that had to recompute the shape functions
+   */
+  unsigned long int feCacheMisses() const { return _fe_cache_misses; }
+
+  /**
+   * Number of elements that were evicted from the FE shape function cache
+   */
+  unsigned long int feCacheEvictions() const { return _fe_cache_evictions; }
+
+  /**
+   * Approximate number of bytes currently held by the FE shape function cache
+   */
+  std::size_t feCacheMemory() const { return _fe_cache_memory; }
+
+  /**
+   * Whether or not this assembly should accumulate residual contributions into a thread-local buffer
+   * instead of adding them to the global residual vector while holding the global spin mutex.
+   *
+   * @param thread_local_residual True for thread-local accumulation, false for locked assembly.
+   */
+  void useThreadLocalResidual(bool thread_local_residual) { _use_thread_local_residual = thread_local_residual; }
+
+  /**
+   * @return Whether or not residual contributions are accumulated into a thread-local buffer
+   */
+  bool usingThreadLocalResidual() const { return _use_thread_local_residual; }
+
   void prepare();
 
   /**
@@ -332,6 +373,33 @@ public:
    */
   void addCachedResidual(NumericVector<Number> & residual, Moose::KernelType type);
 
+  /**
+   * Moves the values that have been cached by calling cacheResidual() and or cacheResidualNeighbor() into the
+   * thread-local residual buffer.  Values belonging to DOFs owned by other processors stay in the cache and are
+   * added by addCachedResidual().  No locking is required.
+   */
+  void accumulateCachedResidual(Moose::KernelType type);
+
+  /**
+   * The thread-local residual buffer, indexed by the local DOF number (global DOF - first local DOF).
+   * The buffer is (re)sized to the current number of local DOFs.
+   */
+  std::vector<Real> & threadLocalResidual(Moose::KernelType type);
+
+  /**
+   * Adds a block of values to an arbitrary vector (i.e. the solution of a save_in variable).  When thread-local
+   * residual assembly is on the values are cached and added later by addCachedVectors(), otherwise they are
+   * added immediately while holding the global spin mutex.
+   */
+  void addSaveInBlock(NumericVector<Number> & vector, const DenseVector<Number> & values, const std::vector<dof_id_type> & dof_indices);
+
+  /**
+   * Adds the values cached by addSaveInBlock() to their vectors.
+   *
+   * Note that this will also clear the cache.
+   */
+  void addCachedVectors();
+
   void setResidual(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
   void setResidualNeighbor(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
 
@@ -353,12 +421,20 @@ public:
   void cacheJacobianNeighbor();
 
   /**
-   * Adds the values that have been cached by calling cacheJacobian() and or cacheJacobianNeighbor() to the jacobian matrix.
+   * Adds the values that have been cached by calling cacheJacobian() and or cacheJacobianNeighbor() to the jacobian matrix,
+   * along with the values moved into the thread-local Jacobian by accumulateCachedJacobian().
    *
    * Note that this will also clear the cache.
    */
   void addCachedJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Moves the values that have been cached by calling cacheJacobian() and or cacheJacobianNeighbor() into the
+   * thread-local Jacobian, summing the contributions to the same entry, so the cache does not grow with the number
+   * of elements.  No locking is required.
+   */
+  void accumulateCachedJacobian();
+
   DenseVector<Number> & residualBlock(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Re[static_cast<unsigned int>(type)][var_num]; }
   DenseVector<Number> & residualBlockNeighbor(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Rn[static_cast<unsigned int>(type)][var_num]; }
 
@@ -580,18 +656,47 @@ protected:
   };
 
   /**
-   * Ok - here's the design.  One ElementFEShapeData class will be stored per element in _fe_shape_data_cache.
-   * When reinit() is called on an element we will retrieve the ElementFEShapeData class associated with that
-   * element.  If it's NULL we'll make one.  Then we'll store a copy of the shape functions computed on that
-   * element within shape_data and JxW and q_points within EleementFEShapeData.
+   * Shape function values shared by the affine elements of one type, along with the reference quadrature points
+   * they were computed at.
+   */
+  class ReferencePhi
+  {
+  public:
+    MooseArray<std::vector<Real> > _phi;
+    std::vector<Point> _qrule_points;
+  };
+
+  /// (element type, FE type, hash of the reference quadrature points)
+  typedef std::pair<std::pair<ElemType, FEType>, std::size_t> ReferencePhiKey;
+
+  /**
+   * Ok - here's the design.  The cache is a flat array of ElementFEShapeData "slots".  _fe_cache_elem_slot maps
+   * the id of each cached element to the slot holding its data.  When reinit() is called on an element without a slot
+   * we hand it a new one, or recycle the least recently used slot once _fe_cache_max_memory is reached, and store
+   * a copy of the shape functions computed on that element along with JxW and q_points.  Recycled slots keep
+   * their allocations, so a full cache does not touch the heap.
+   *
+   * For affine elements the LAGRANGE shape function values are the same on every element of the same type, so
+   * they are stored once per quadrature rule in _fe_cache_reference_phi and the slot only points at them.
    */
   class ElementFEShapeData
   {
   public:
-    /// This is where the cached shape functions will be held
-    std::map<FEType, FEShapeData *> _shape_data;
+    ElementFEShapeData() :
+        _invalidated(true),
+        _elem_id(DofObject::invalid_id),
+        _lru_prev(-1),
+        _lru_next(-1),
+        _memory(0)
+    {}
+
+    /// This is where the cached shape functions will be held (indexed in the order of _fe[dim])
+    std::vector<FEShapeData> _shape_data;
 
-    /// Whether or not this data is invalid (needs to be recached) note that there is no constructor so the value is invalid the first time through and must be set.
+    /// Shared shape function values for each FE type (NULL when _shape_data holds its own values)
+    std::vector<ReferencePhi *> _reference_phi;
+
+    /// Whether or not this data is invalid (needs to be recached)
     bool _invalidated;
 
     /// Cached JxW
@@ -599,10 +704,67 @@ protected:
 
     /// Cached xyz positions of quadrature points
     MooseArray<Point> _q_points;
+
+    /// The element currently stored in this slot
+    dof_id_type _elem_id;
+
+    /// Neighbors in the least recently used list
+    int _lru_prev;
+    int _lru_next;
+
+    /// Approximate number of bytes held by this slot
+    std::size_t _memory;
   };
 
-  /// Cached shape function values stored by element
-  std::map<unsigned int, ElementFEShapeData * > _element_fe_shape_data_cache;
+  /**
+   * Find (or make) the cache slot for an element and mark it as the most recently used one.
+   */
+  ElementFEShapeData & feCacheSlot(const Elem * elem);
+
+  /**
+   * Unlink a slot from the least recently used list.
+   */
+  void feCacheUnlink(int slot);
+
+  /**
+   * Approximate number of bytes held by a slot.
+   */
+  std::size_t feCacheSlotMemory(const ElementFEShapeData & efesd);
+
+  /**
+   * Find (or store) the shape function values shared by the affine elements of this type integrated with the
+   * current quadrature rule, NULL if the element has to keep its own values.
+   */
+  ReferencePhi * feCacheReferencePhi(const Elem * elem, const FEType & fe_type, const FEShapeData & fesd);
+
+  /**
+   * Approximate number of bytes held by shared reference values.
+   */
+  std::size_t referencePhiMemory(const ReferencePhi & reference_phi);
+
+  /// Cached shape function values
+  std::vector<ElementFEShapeData> _fe_cache;
+
+  /// Slot in _fe_cache for each cached element (only the elements this thread has seen, not the whole mesh)
+  std::map<dof_id_type, int> _fe_cache_elem_slot;
+
+  /// Most and least recently used slots
+  int _fe_cache_lru_head;
+  int _fe_cache_lru_tail;
+
+  /// Shape function values shared by all affine elements of the same type integrated with the same rule
+  std::map<ReferencePhiKey, ReferencePhi> _fe_cache_reference_phi;
+
+  /// Memory limit for the cache in bytes (0 for no limit)
+  std::size_t _fe_cache_max_memory;
+
+  /// Approximate number of bytes held by the cache (including the shared reference values)
+  std::size_t _fe_cache_memory;
+
+  /// Cache statistics
+  unsigned long int _fe_cache_hits;
+  unsigned long int _fe_cache_misses;
+  unsigned long int _fe_cache_evictions;
 
   /// Whether or not fe cache should be built at all
   bool _should_use_fe_cache;
@@ -623,6 +785,15 @@ protected:
 
   unsigned int _max_cached_residuals;
 
+  /// Whether or not residual contributions are accumulated into _thread_local_residual
+  bool _use_thread_local_residual;
+
+  /// Residual accumulated by this thread indexed by local DOF (the first vector is for TIME vs NONTIME)
+  std::vector<std::vector<Real> > _thread_local_residual;
+
+  /// Values cached by calling addSaveInBlock() along with the DOFs they belong to, per vector
+  std::map<NumericVector<Number> *, std::pair<std::vector<Real>, std::vector<dof_id_type> > > _cached_vector_values;
+
   /// Values cached by calling cacheJacobian()
   std::vector<Real> _cached_jacobian_values;
   /// Row where the corresponding cached value should go
@@ -632,6 +803,9 @@ protected:
 
   unsigned int _max_cached_jacobians;
 
+  /// Jacobian accumulated by this thread, indexed by (row, column)
+  std::map<std::pair<unsigned int, unsigned int>, Real> _thread_local_jacobian;
+
   /// Will be true if our preconditioning matrix is a block-diagonal matrix.  Which means that we can take some shortcuts.
   unsigned int _block_diagonal_matrix;
 
@@ -59,6 +59,13 @@ public:
    */
   virtual void useFECache(bool fe_cache);
 
+  /**
+   * Whether or not the displaced assemblies should accumulate residual contributions thread-locally.
+   *
+   * @param thread_local_residual True for thread-local accumulation, false for locked assembly.
+   */
+  virtual void useThreadLocalResidual(bool thread_local_residual);
+
   virtual void init();
   virtual void solve();
   virtual bool converged();
@@ -116,6 +123,7 @@ public:
   virtual void cacheResidual(THREAD_ID tid);
   virtual void cacheResidualNeighbor(THREAD_ID tid);
   virtual void addCachedResidual(THREAD_ID tid);
+  virtual void accumulateCachedResidual(THREAD_ID tid);
 
   virtual void addCachedResidualDirectly(NumericVector<Number> & residual, THREAD_ID tid);
 
@@ -130,6 +138,7 @@ public:
   virtual void cacheJacobian(THREAD_ID tid);
   virtual void cacheJacobianNeighbor(THREAD_ID tid);
   virtual void addCachedJacobian(SparseMatrix<Number> & jacobian, THREAD_ID tid);
+  virtual void accumulateCachedJacobian(THREAD_ID tid);
 
   virtual void prepareShapes(unsigned int var, THREAD_ID tid);
   virtual void prepareFaceShapes(unsigned int var, THREAD_ID tid);
@@ -271,9 +271,37 @@ public:
    */
   virtual void useFECache(bool fe_cache);
 
+  /**
+   * Limit the memory used by the FE shape function cache of each thread.
+   *
+   * @param max_memory The maximum number of bytes per thread (0 for no limit).
+   */
+  virtual void setFECacheMaxMemory(std::size_t max_memory);
+
+  /**
+   * Whether or not residual contributions should be accumulated into thread-local buffers indexed by local DOF
+   * and combined once per evaluation, instead of being added to the residual while holding the global spin mutex.
+   *
+   * @param thread_local_residual True for thread-local accumulation, false for locked assembly.
+   */
+  virtual void useThreadLocalResidual(bool thread_local_residual);
+
+  /**
+   * @return Whether or not residual contributions are accumulated into thread-local buffers
+   */
+  bool threadLocalResidual() const { return _thread_local_residual; }
+
   virtual void init();
   virtual void init2();
   virtual void solve();
+
+  /**
+   * Sets the PETSc options for this problem and creates its nonlinear solver from them, which
+   * solve() otherwise does every time it is called.  The PETSc options are shared by the whole
+   * process, so the Apps of a MultiApp that are solved concurrently call this one at a time before
+   * any of them starts to solve, and their next solve() leaves the options alone.
+   */
+  void setupSolver();
   virtual bool converged();
   virtual unsigned int nNonlinearIterations() { return _nl.nNonlinearIterations(); }
   virtual unsigned int nLinearIterations() { return _nl.nLinearIterations(); }
@@ -551,6 +579,18 @@ public:
   virtual void cacheResidualNeighbor(THREAD_ID tid);
   virtual void addCachedResidual(THREAD_ID tid);
 
+  /**
+   * Moves the cached residual contributions of thread tid into its thread-local residual buffer.
+   * @param tid The thread id.
+   */
+  virtual void accumulateCachedResidual(THREAD_ID tid);
+
+  /**
+   * Sums the thread-local residual buffers of all threads (with a threaded reduction over the local DOFs) and adds
+   * the result to the residual.  Contributions to off-processor DOFs are left in the cache for addCachedResidual().
+   */
+  virtual void addThreadLocalResiduals();
+
   /**
    * Allows for all the residual contributions that are currently cached to be added directly into the vector passed in.
    *
@@ -573,6 +613,12 @@ public:
   virtual void cacheJacobianNeighbor(THREAD_ID tid);
   virtual void addCachedJacobian(SparseMatrix<Number> & jacobian, THREAD_ID tid);
 
+  /**
+   * Moves the cached Jacobian contributions of thread tid into its thread-local Jacobian.
+   * @param tid The thread id.
+   */
+  virtual void accumulateCachedJacobian(THREAD_ID tid);
+
   virtual void prepareShapes(unsigned int var, THREAD_ID tid);
   virtual void prepareFaceShapes(unsigned int var, THREAD_ID tid);
   virtual void prepareNeighborShapes(unsigned int var, THREAD_ID tid);
@@ -680,6 +726,20 @@ public:
    */
   virtual bool isRecovering();
 
+  /**
+   * Write the state of this problem (the vectors of every system, the restartable data and
+   * the stateful material properties) to a stream.  Only valid for a serial problem.
+   * @param stream The stream to write to
+   */
+  virtual void backup(std::ostream & stream);
+
+  /**
+   * Restore a state written by backup().  This problem must have been set up from the same
+   * input as the one that was backed up.
+   * @param stream The stream to read from
+   */
+  virtual void restore(std::istream & stream);
+
   /**
    * Register a piece of restartable data.  This is data that will get
    * written / read to / from a restart file.
@@ -783,6 +843,9 @@ protected:
   /// Whether or not to actually solve the nonlinear system
   bool _solve;
 
+  /// Whether setupSolver() was called since the last solve
+  bool _solver_set_up;
+
   bool _transient;
   Real & _time;
   Real & _time_old;
@@ -926,6 +989,9 @@ protected:
   /// Whether nor not stateful materials have been initialized
   bool _has_initialized_stateful;
 
+  /// Number of ghosted elements the last time the ghosting was set up
+  dof_id_type _n_ghosted_elems;
+
   /// Object responsible for restart (read/write)
   Resurrector * _resurrector;
 
@@ -963,6 +1029,9 @@ protected:
   /// Maximum number of quadrature points used in the problem
   unsigned int _max_qps;
 
+  /// Whether or not residual contributions are accumulated into thread-local buffers
+  bool _thread_local_residual;
+
 public:
   /// number of instances of FEProblem (to distinguish Systems when coupling problems together)
   static unsigned int _n;
@@ -80,6 +80,19 @@ extern PerfLog perf_log;
  */
 extern PerfLog setup_perf_log;
 
+/**
+ * The perf logs of the calling thread.  These are perf_log and setup_perf_log, except on a thread that
+ * was given its own logs with setThreadPerfLogs() (i.e. the Apps of a MultiApp solved concurrently).
+ * Timed events should be pushed and popped through these.
+ */
+PerfLog & perfLog();
+PerfLog & setupPerfLog();
+
+/**
+ * Sets the perf logs of the calling thread, NULL goes back to perf_log and setup_perf_log.
+ */
+void setThreadPerfLogs(PerfLog * thread_perf_log, PerfLog * thread_setup_perf_log);
+
 /**
  * Variable indicating whether we will enable FPE trapping for this run.
  */
@@ -30,6 +30,28 @@
 class Assembly;
 class SubProblem;
 class SystemBase;
+class MooseVariable;
+
+/**
+ * The solution vector values at the DOFs of a set of variables on the current element, gathered with
+ * one NumericVector::get() per vector.  The values of the v-th variable start at offsets[v].
+ */
+struct ElemSolutionGather
+{
+  std::vector<numeric_index_type> dof_indices;
+  std::vector<unsigned int> offsets;
+
+  std::vector<Real> soln;
+  std::vector<Real> soln_old;
+  std::vector<Real> soln_older;
+  std::vector<Real> u_dot;
+  std::vector<Real> du_dot_du;
+
+  /// Scratch space for the groups of variables that are computed together
+  std::vector<MooseVariable *> group;
+  std::vector<unsigned int> group_offsets;
+  std::vector<bool> grouped;
+};
 
 /**
  * Class for stuff related to variables
@@ -180,6 +202,13 @@ public:
    * Compute values at interior quadrature points
    */
   void computeElemValues();
+
+  /**
+   * Compute values at interior quadrature points for several variables of the same system.  The
+   * DOF values of all of the variables are gathered into gather once, then the variables with the same
+   * FEType are computed together in one loop over the shape functions.
+   */
+  static void computeElemValues(const std::vector<MooseVariable *> & vars, ElemSolutionGather & gather);
   /**
    * Compute values at facial quadrature points
    */
@@ -289,6 +318,20 @@ protected:
    */
   void getDofIndices(const Elem * elem, std::vector<dof_id_type> & dof_indices);
 
+  /**
+   * Gathers the values of the solution vectors needed by the n_vars variables at their DOF indices
+   */
+  static void gatherElemSolution(MooseVariable * const * vars, unsigned int n_vars, ElemSolutionGather & gather);
+
+  /**
+   * Computes the values at interior quadrature points of n_vars variables with the same FEType and
+   * number of DOFs from the gathered DOF values, the values of vars[v] starting at offsets[v]
+   */
+  static void computeElemValues(MooseVariable * const * vars, const unsigned int * offsets, unsigned int n_vars, const ElemSolutionGather & gather);
+
+  /// Sizes the interior values to nqp quadrature points and zeros them
+  void zeroElemValues(unsigned int nqp, bool is_transient);
+
 protected:
   /// Thread ID
   THREAD_ID _tid;
@@ -411,6 +454,9 @@ protected:
   /// scaling factor for this variable
   Real _scaling_factor;
 
+  /// The gathered DOF values when computeElemValues() is called on this variable alone
+  ElemSolutionGather _elem_gather;
+
   friend class NodeFaceConstraint;
   friend class ValueThresholdMarker;
   friend class ValueRangeMarker;
@@ -368,6 +368,10 @@ protected:
   /// Map of variables (variable id -> array of subdomains where it lives)
   std::map<unsigned int, std::set<SubdomainID> > _var_map;
 
+  /// The variables computed by reinitElem() and their gathered DOF values (one for each thread)
+  std::vector<std::vector<MooseVariable *> > _reinit_vars;
+  std::vector<ElemSolutionGather> _elem_gather;
+
   std::vector<std::string> _vars_to_be_zeroed_on_residual;
   std::vector<std::string> _vars_to_be_zeroed_on_jacobian;
 };
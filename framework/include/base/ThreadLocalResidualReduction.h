@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef THREADLOCALRESIDUALREDUCTION_H
+#define THREADLOCALRESIDUALREDUCTION_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+/**
+ * Sums the thread-local residual buffers (see Assembly::threadLocalResidual()) over a range of local DOFs.
+ * The buffers are zeroed as they are summed so they are ready for the next residual evaluation.
+ */
+class ThreadLocalResidualReduction
+{
+public:
+  /**
+   * @param buffers The thread-local residual buffers to sum, all indexed by local DOF
+   * @param sum Where the sum is written, indexed by local DOF
+   */
+  ThreadLocalResidualReduction(std::vector<std::vector<Real> *> & buffers, std::vector<Real> & sum);
+
+  void operator() (const Threads::BlockedRange<dof_id_type> & range) const;
+
+protected:
+  std::vector<std::vector<Real> *> & _buffers;
+
+  std::vector<Real> & _sum;
+};
+
+#endif //THREADLOCALRESIDUALREDUCTION_H
@@ -35,8 +35,16 @@ public:
 protected:
   virtual Real computeQpResidual();
 
+  /**
+   * Evaluates the function at all of the quadrature points of the side.
+   */
+  virtual void precalculateResidual();
+
   /// The function being used for setting the value
   Function & _func;
+
+  /// Values of the function at the quadrature points
+  std::vector<Real> _func_values;
 };
 
 #endif // FUNCTIONNEUMANNBC_H
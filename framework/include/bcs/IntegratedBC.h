@@ -128,6 +128,10 @@ protected:
    */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /**
+   * Called once per side before the residual is computed at the quadrature points.
+   */
+  virtual void precalculateResidual();
 };
 
 #endif /* INTEGRATEDBC_H */
@@ -141,13 +141,23 @@ protected:
   void addPoint(const Elem * elem, Point p);
 
   /**
-   * This is a highly inefficient way to add a point where this DiracKernel needs to be
-   * evaluated.
+   * Add a point where this DiracKernel needs to be evaluated.
    *
-   * This spawns a search for the element containing that point!
+   * This spawns a search for the element containing that point, use addPoints() when
+   * there are many points to add.
    */
   const Elem * addPoint(Point p);
 
+  /**
+   * Add a list of points where this DiracKernel needs to be evaluated.
+   *
+   * The elements containing the points are all found with the point locator cached
+   * by the SubProblem.
+   * @param points The points to add
+   * @param elems The elements containing the points are returned here (NULL for points outside the mesh)
+   */
+  void addPoints(const std::vector<Point> & points, std::vector<const Elem *> & elems);
+
   SubProblem & _subproblem;
   SystemBase & _sys;
 
@@ -166,10 +176,8 @@ protected:
 
   DiracKernelInfo & _dirac_kernel_info;
 
-  /// The list of elements that need distributions
-  std::set<const Elem *> _elements;
-  /// The list of physical xyz Points that need to be evaluated in each element
-  std::map<const Elem *, std::set<Point> > _points;
+  /// The elements and physical xyz Points that need to be evaluated by this DiracKernel
+  DiracKernelInfo _local_dirac_kernel_info;
 
   //std::vector<Point> & _current_points;               ///< The points on the current element
 
@@ -21,9 +21,13 @@
 // libMesh
 #include "libmesh/elem.h"
 #include "libmesh/point.h"
+#include "libmesh/point_locator_base.h"
 
 #include <set>
-#include <map>
+#include <vector>
+
+// Forward declarations
+class MooseMesh;
 
 namespace libMesh
 {
@@ -31,7 +35,13 @@ namespace libMesh
 }
 
 /**
- * TODO
+ * Holds the points (and the elements containing them) where DiracKernels
+ * need to be evaluated.
+ *
+ * The points are kept in a single vector of (element, point) pairs that is
+ * sorted lazily the first time it is queried after points were added.  The
+ * point locator used to find the element containing a point is built once
+ * and reused until clearPointLocator() is called when the mesh changes.
  */
 class DiracKernelInfo
 {
@@ -39,6 +49,9 @@ public:
   DiracKernelInfo();
   virtual ~DiracKernelInfo();
 
+  /// An element and a point located inside it
+  typedef std::pair<const Elem *, Point> ElemPoint;
+
 public:
   /**
    * Adds a point source
@@ -47,16 +60,67 @@ public:
    */
   void addPoint(const Elem * elem, Point p);
 
-  /// The list of elements that need distributions.
-  std::set<const Elem *> _elements;
+  /**
+   * Whether or not there are points to evaluate on the element.
+   */
+  bool hasPointsOnElem(const Elem * elem);
+
+  /**
+   * Whether or not the point has been added on the element.
+   */
+  bool hasPoint(const Elem * elem, const Point & p);
+
+  /**
+   * Get the (unique, sorted) points that were added on the element.
+   * @param elem Element
+   * @param points The points are returned here
+   */
+  void getPoints(const Elem * elem, std::vector<Point> & points);
+
+  /**
+   * Get the elements that have points on them.
+   */
+  void getElements(std::set<const Elem *> & elems);
+
+  /**
+   * Find the element containing a point using the cached point locator.
+   * The locator is built on first use.
+   * @param p The point to look for
+   * @param mesh The mesh to search (must be the same mesh on every call until clearPointLocator())
+   * @return The element containing the point or NULL when it is not in the mesh
+   */
+  const Elem * findPoint(const Point & p, MooseMesh & mesh);
 
-  /// The list of physical xyz Points that need to be evaluated in each element.
-  std::map<const Elem *, std::set<Point> > _points;
+  /**
+   * Throw away the point locator, this has to be called every time the mesh changes
+   * (adaptivity, moving nodes).
+   */
+  void clearPointLocator();
 
   /**
    * Remove all of the current points and elements.
    */
   void clearPoints();
+
+protected:
+  /**
+   * Sort the points and remove the duplicates if there were any points added since the last sort.
+   */
+  void sortPoints();
+
+  /**
+   * Get the range of the sorted point list belonging to an element.
+   */
+  std::pair<std::vector<ElemPoint>::const_iterator, std::vector<ElemPoint>::const_iterator> elemRange(const Elem * elem);
+
+  /// The (element, point) pairs that need to be evaluated
+  std::vector<ElemPoint> _points;
+
+  /// Whether or not _points is currently sorted and unique
+  bool _sorted;
+
+  /// Point locator used to find the element containing a point
+  AutoPtr<PointLocatorBase> _point_locator;
 };
 
 #endif //DIRACKERNELINFO_H
@@ -35,10 +35,18 @@ public:
 
   virtual Real value(Real t, const Point & pt);
 
+  /**
+   * Evaluates each of the functions for all of the points at once and multiplies the results
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
 private:
   const Real _scale_factor;
   std::vector<Function *> _f;
 
+  /// Values of one of the functions, used by values()
+  std::vector<Real> _f_values;
+
 };
 
 #endif //COMPOSITE_H
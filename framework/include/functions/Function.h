@@ -21,6 +21,7 @@
 #include "PostprocessorInterface.h"
 #include "UserObjectInterface.h"
 #include "Restartable.h"
+#include "MooseArray.h"
 
 // libMesh
 #include "libmesh/vector_value.h"
@@ -65,6 +66,16 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at a set of points (typically all of the quadrature points
+   * of an element or a face) at once.  By default this calls value() for each point, override it
+   * when the evaluation can be shared between the points.
+   * \param t The time
+   * \param p The Points in space (x,y,z)
+   * \param values The values of the function at the points are returned here
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
@@ -83,6 +94,15 @@ public:
    */
   virtual RealGradient gradient(Real t, const Point & p);
 
+  /**
+   * Function objects can optionally provide a time derivative at a point. By default
+   * this returns 0, you must override it.
+   * \param t The time
+   * \param p The Point in space (x,y,z)
+   * \return The derivative of the function with respect to time
+   */
+  virtual Real timeDerivative(Real t, const Point & p);
+
   // Not defined
   virtual Real integral();
 
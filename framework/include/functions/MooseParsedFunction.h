@@ -66,6 +66,30 @@ public:
    */
   virtual Real value(Real t, const Point & pt);
 
+  /**
+   * Evaluate the equation at a set of points.
+   * @param t The evaluation time
+   * @param p The points (x,y,z)
+   * @param values The results are returned here
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
+  /**
+   * Evaluate the gradient of the function, this is only available with enable_jit = true
+   * (the gradient is zero otherwise, as for any Function that does not provide one).
+   * @param t The evaluation time
+   * @param pt The current point (x,y,z)
+   */
+  virtual RealGradient gradient(Real t, const Point & pt);
+
+  /**
+   * Evaluate the derivative of the function with respect to time, this is only available with
+   * enable_jit = true (the derivative is zero otherwise, as for the gradient).
+   * @param t The evaluation time
+   * @param pt The current point (x,y,z)
+   */
+  virtual Real timeDerivative(Real t, const Point & pt);
+
   /**
    * Method invalid for ParsedGradFunction
    * @see ParsedVectorFunction
@@ -82,6 +106,9 @@ protected:
   /// The function defined by the user
   std::string _value;
 
+  /// Whether or not the function should be compiled to native code
+  bool _enable_jit;
+
   /// Pointer to the wrapper object for the function
   MooseParsedFunctionWrapper * _function_ptr;
 
@@ -26,6 +26,8 @@
 
 // MOOSE includes
 #include "FEProblem.h"
+#include "MooseArray.h"
+#include "ParsedFunctionJIT.h"
 
 /**
  * A wrapper class for creating and evaluating parsed functions via the
@@ -44,11 +46,13 @@ public:
    * @param function_str A string that contains the function to evaluate
    * @param vars A vector of variable names contained within the function
    * @param vals A vector of variable values, matching the variables defined in vars
+   * @param enable_jit Compile the function to native code (falls back to fparser if that fails)
    */
   MooseParsedFunctionWrapper(FEProblem & feproblem,
                               const std::string & function_str,
                               const std::vector<std::string> & vars,
-                              const std::vector<std::string> & vals);
+                              const std::vector<std::string> & vals,
+                              bool enable_jit = false);
 
   /**
    * Class destruction
@@ -65,6 +69,28 @@ public:
   template<typename T>
   T evaluate(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at a set of points
+   */
+  void evaluate(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
+  /**
+   * Evaluate the gradient of the function.  This is exact when the function was compiled
+   * and computed by central differences otherwise.
+   */
+  RealGradient evaluateGradient(Real t, const Point & p);
+
+  /**
+   * Evaluate the time derivative of the function (exact when the function was compiled,
+   * central differences otherwise).
+   */
+  Real evaluateDot(Real t, const Point & p);
+
+  /**
+   * Whether the function was compiled to native code (false when fparser evaluates it)
+   */
+  bool isCompiled() const { return _jit != NULL; }
+
 private:
 
   /// Reference to the FEProblem object
@@ -94,6 +120,12 @@ private:
   /// Vector of pointers to the variables in libMesh::ParsedFunction
   std::vector<Real *> _addr;
 
+  /// The compiled function, NULL when JIT compilation was not requested or failed
+  ParsedFunctionJIT * _jit;
+
+  /// The inputs of the compiled function: x, y, z, t followed by the variables
+  std::vector<Real> _jit_input;
+
   /**
    * Initialization method that prepares the vars and vals for use
    * by the libMesh::ParsedFunction object allocated in the constructor
@@ -101,10 +133,15 @@ private:
   void initialize();
 
   /**
-   * Updates postprocessor values for use in the libMesh::ParsedFunction
+   * Updates postprocessor values for use in the libMesh::ParsedFunction (and the compiled function)
    */
   void update();
 
+  /**
+   * Copy the time and location into the inputs of the compiled function
+   */
+  void setJITInput(Real t, const Point & p);
+
   // moose_unit needs access
   friend class ParsedFunctionTest;
 
@@ -39,7 +39,10 @@ public:
    */
   virtual Real value(Real t, const Point & pt);
 
-
+  /**
+   * Sample the table for all of the points at once
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
 
 private:
   BilinearInterpolation * _bilinear_interp;
@@ -54,9 +57,18 @@ private:
   const bool _radial;
 
 
+  /// Coordinates in the table of the points passed to values()
+  std::vector<Real> _xcoords;
+  std::vector<Real> _ycoords;
+
   void parse( std::vector<Real> & x,
               std::vector<Real> & y,
               ColumnMajorMatrix & z);
+
+  /**
+   * Get the coordinates in the table of a point at a given time
+   */
+  void tableCoordinates(Real t, const Point & p, Real & x, Real & y) const;
 };
 
 #endif //PIECEWISEBILINEAR_H
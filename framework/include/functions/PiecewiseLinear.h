@@ -32,6 +32,12 @@ public:
    * This function will return a value based on the first input argument only.
    */
   virtual Real value(Real t, const Point & pt);
+
+  /**
+   * Sample the table once for all of the points
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
   /**
    * This function will return a value based on the first input argument only.
    */
@@ -41,6 +47,9 @@ public:
 
   virtual Real average();
 
+protected:
+  /// Coordinates of the points along the axis, used by values()
+  std::vector<Real> _axis_coords;
 };
 
 template<>
@@ -66,6 +66,9 @@ private:
   /// the grid
   std::vector<std::vector<Real> > _grid;
 
+  /// the interval along each axis found by the last sample, checked first by the next one
+  std::vector<unsigned int> _last_interval;
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
@@ -83,8 +86,9 @@ private:
    * @param x The real value for which we want the neighbor indices
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
+   * @param hint The interval to search first, upon return contains the interval containing x
    */
-  void getNeighborIndices(std::vector<Real> in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+  void getNeighborIndices(const std::vector<Real> & in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x, unsigned int & hint);
 };
 
 #endif //PIECEWISEMULTILINEAR_H
@@ -50,6 +50,13 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /** Extract the values from the solution at a set of points
+   * @param t Time at which to extract
+   * @param p Spatial locations of desired data
+   * @param values The values at t and p are returned here
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
   // virtual RealGradient gradient(Real t, const Point & p);
 
   /** Setup the function for use
@@ -19,9 +19,11 @@
 #include "MooseMesh.h"
 #include "libmesh/vector_value.h"
 #include "Restartable.h"
+#include "KDTree.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_tools.h"
 
 // System
 #include <vector>
@@ -73,6 +75,12 @@ public:
    */
   NodeIdRange & slaveNodeRange() { return *_slave_node_range; }
 
+  /**
+   * The number of slave node patches rebuilt because the nearest node reached the edge of the patch
+   * (only done with patch_update_strategy = auto).
+   */
+  unsigned long int patchRebuilds() const { return _patch_rebuilds; }
+
   /**
    * Data structure used to hold nearest node info.
    */
@@ -86,12 +94,30 @@ public:
   };
 
 protected:
+  /**
+   * Rebuild the patches of slave nodes whose nearest node reached the edge of their patch, ghost any new
+   * elements and find their nearest nodes again.
+   */
+  void updatePatches(std::vector<unsigned int> & slave_nodes);
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
 
   NodeIdRange * _slave_node_range;
 
+  /// Master nodes considered for the neighborhoods
+  std::vector<unsigned int> _trial_master_nodes;
+
+  /// The inflated bounding box the master nodes are picked from (NULL without ghosted_boundaries_inflation)
+  MeshTools::BoundingBox * _inflated_box;
+
+  /// Spatial index over the master nodes, kept around so rebuilding it reuses its memory
+  KDTree _master_tree;
+
+  /// Total number of slave node patches rebuilt
+  unsigned long int _patch_rebuilds;
+
 public:
   std::map<unsigned int, NearestNodeInfo> _nearest_node_info;
 
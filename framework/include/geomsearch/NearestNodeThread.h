@@ -21,7 +21,8 @@ class NearestNodeThread
 {
 public:
   NearestNodeThread(const MooseMesh & mesh,
-                    std::map<unsigned int, std::vector<unsigned int> > & neighbor_nodes);
+                    std::map<unsigned int, std::vector<unsigned int> > & neighbor_nodes,
+                    unsigned int patch_size = 0);
 
   // Splitting Constructor
   NearestNodeThread(NearestNodeThread & x, Threads::split split);
@@ -33,12 +34,18 @@ public:
   // This is the info map we're actually filling here
   std::map<unsigned int, NearestNodeLocator::NearestNodeInfo> _nearest_node_info;
 
+  // Slave nodes whose nearest node is in the outer half of their neighborhood
+  std::vector<unsigned int> _slave_nodes_to_update;
+
 protected:
   // The Mesh
   const MooseMesh & _mesh;
 
   // The neighborhood nodes associated with each node
   std::map<unsigned int, std::vector<unsigned int> > & _neighbor_nodes;
+
+  // Size of a full neighborhood (0 to not look for nodes needing an update)
+  unsigned int _patch_size;
 };
 
 #endif //NEARESTNODETHREAD_H
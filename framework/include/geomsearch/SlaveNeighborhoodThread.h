@@ -17,6 +17,7 @@
 
 #include "MooseTypes.h"
 #include "MooseMesh.h"
+#include "KDTree.h"
 // libMesh
 #include "libmesh/mesh_base.h"
 // System
@@ -27,6 +28,7 @@ class SlaveNeighborhoodThread
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<unsigned int> & trial_master_nodes,
+                          const KDTree & master_tree,
                           std::map<unsigned int, std::vector<unsigned int> > & node_to_elem_map,
                           const unsigned int patch_size);
 
@@ -54,6 +56,9 @@ protected:
   /// Nodes to search against
   const std::vector<unsigned int> & _trial_master_nodes;
 
+  /// Spatial index over _trial_master_nodes
+  const KDTree & _master_tree;
+
   /// Node to elem map
   std::map<unsigned int, std::vector<unsigned int> > & _node_to_elem_map;
 
@@ -17,6 +17,7 @@
 
 #include "InitialCondition.h"
 #include "InputParameters.h"
+#include "MooseArray.h"
 
 #include <string>
 
@@ -36,6 +37,8 @@ class FunctionIC : public InitialCondition
 public:
   FunctionIC(const std::string & name, InputParameters parameters);
 
+  virtual ~FunctionIC();
+
 protected:
   /**
    * Evaluate the function at the current quadrature point and timestep.
@@ -49,7 +52,15 @@ protected:
    */
   virtual Real value(const Point &p);
 
+  /**
+   * The values of the variable at a set of points, evaluated with a single call to the function.
+   */
+  virtual void values(const std::vector<Point> & points, std::vector<Real> & values);
+
   Function & _func;
+
+  /// Copy of the points being evaluated in the form the function expects
+  MooseArray<Point> _points;
 };
 
 #endif //FUNCTIONIC_H
@@ -87,6 +87,15 @@ public:
    */
   virtual RealGradient gradient(const Point & /*p*/) { return RealGradient(); };
 
+  /**
+   * The values of the variable at a set of points.
+   *
+   * The default calls value() for each point; derived classes can evaluate all of them at once.
+   * @param points The points to evaluate at
+   * @param values The values at the points (resized to match)
+   */
+  virtual void values(const std::vector<Point> & points, std::vector<Real> & values);
+
   /**
    * Gets called at the beginning of the simulation before this object is asked to do its job.
    * Note: This method is normally inherited from SetupInterface.  However in this case it makes
@@ -116,6 +125,9 @@ protected:
 
   unsigned int _qp;
 
+  /// Values at the quadrature points of the edge, side or element being projected
+  std::vector<Real> _qp_values;
+
   std::set<std::string> _depend_vars;
   std::set<std::string> _supplied_vars;
 };
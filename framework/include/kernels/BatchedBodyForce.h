@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BATCHEDBODYFORCE_H
+#define BATCHEDBODYFORCE_H
+
+#include "BatchedKernel.h"
+
+//Forward Declarations
+class BatchedBodyForce;
+class Function;
+
+template<>
+InputParameters validParams<BatchedBodyForce>();
+
+/**
+ * BodyForce evaluated for all quadrature points at once.
+ */
+class BatchedBodyForce : public BatchedKernel
+{
+public:
+
+  BatchedBodyForce(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual void computeBatchResidual();
+
+  Real _value;
+  const bool _has_function;
+  Function * const _function;
+};
+
+#endif
@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BATCHEDCOUPLEDFORCE_H
+#define BATCHEDCOUPLEDFORCE_H
+
+#include "BatchedKernel.h"
+
+// Forward Declaration
+class BatchedCoupledForce;
+
+template<>
+InputParameters validParams<BatchedCoupledForce>();
+
+/**
+ * CoupledForce evaluated for all quadrature points at once.
+ */
+class BatchedCoupledForce : public BatchedKernel
+{
+public:
+  BatchedCoupledForce(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual void computeBatchResidual();
+
+  virtual void computeBatchOffDiagJacobian(unsigned int jvar);
+
+private:
+  unsigned int _v_var;
+  VariableValue & _v;
+};
+
+#endif //BATCHEDCOUPLEDFORCE_H
@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BATCHEDDIFFUSION_H
+#define BATCHEDDIFFUSION_H
+
+#include "BatchedKernel.h"
+
+class BatchedDiffusion;
+
+template<>
+InputParameters validParams<BatchedDiffusion>();
+
+/**
+ * Diffusion evaluated for all quadrature points at once.
+ */
+class BatchedDiffusion : public BatchedKernel
+{
+public:
+  BatchedDiffusion(const std::string & name, InputParameters parameters);
+  virtual ~BatchedDiffusion();
+
+protected:
+  virtual void computeBatchResidual();
+  virtual void computeBatchJacobian();
+};
+
+#endif /* BATCHEDDIFFUSION_H */
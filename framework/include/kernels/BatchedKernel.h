@@ -0,0 +1,89 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BATCHEDKERNEL_H
+#define BATCHEDKERNEL_H
+
+#include "Kernel.h"
+#include "QpBatch.h"
+
+//Forward Declarations
+class BatchedKernel;
+
+template<>
+InputParameters validParams<BatchedKernel>();
+
+/**
+ * The BatchedKernel class evaluates residuals and Jacobians of the form:
+ *
+ *  JxW[_qp] * (_value[_qp] * _test[_i][_qp] + _grad_value[_qp] * _grad_test[_i][_qp])
+ *
+ * Derived classes compute the coefficients for all quadrature points of the element at once
+ * (see QpBatch) instead of providing one computeQpResidual() call per (i, qp) pair, which lets
+ * the inner loops run over contiguous arrays.
+ */
+class BatchedKernel : public Kernel
+{
+public:
+  /**
+   * Factory constructor initializes all internal references needed for residual computation.
+   *
+   * @param name The name of this kernel.
+   * @param parameters The parameters object for holding additional parameters for kernels and derived kernels
+   */
+  BatchedKernel(const std::string & name, InputParameters parameters);
+
+  virtual ~BatchedKernel();
+
+  /**
+   * Computes the residual for the current element.
+   */
+  virtual void computeResidual();
+
+  /**
+   * Computes the jacobian for the current element.
+   */
+  virtual void computeJacobian();
+
+  /**
+   * Computes d-residual / d-jvar...
+   */
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
+protected:
+  /**
+   * Fill _batch.value() and/or _batch.gradValue() for all quadrature points.
+   */
+  virtual void computeBatchResidual() = 0;
+
+  /**
+   * Fill _batch.phiCoef() and/or _batch.gradPhiCoef() for all quadrature points.  Does nothing by default.
+   */
+  virtual void computeBatchJacobian();
+
+  /**
+   * Fill _batch.phiCoef() and/or _batch.gradPhiCoef() for the jvar block.  Does nothing by default.
+   */
+  virtual void computeBatchOffDiagJacobian(unsigned int jvar);
+
+  /**
+   * Not used: the residual is computed for all quadrature points at once in computeBatchResidual().
+   */
+  virtual Real computeQpResidual();
+
+  /// Coefficients for all the quadrature points of the current element
+  QpBatch _batch;
+};
+
+#endif //BATCHEDKERNEL_H
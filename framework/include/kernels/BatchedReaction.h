@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BATCHEDREACTION_H
+#define BATCHEDREACTION_H
+
+#include "BatchedKernel.h"
+
+// Forward Declaration
+class BatchedReaction;
+
+template<>
+InputParameters validParams<BatchedReaction>();
+
+/**
+ * Reaction evaluated for all quadrature points at once.
+ */
+class BatchedReaction : public BatchedKernel
+{
+public:
+  BatchedReaction(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual void computeBatchResidual();
+  virtual void computeBatchJacobian();
+};
+
+#endif //BATCHEDREACTION_H
@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BATCHEDTIMEDERIVATIVE_H
+#define BATCHEDTIMEDERIVATIVE_H
+
+#include "TimeKernel.h"
+#include "QpBatch.h"
+
+// Forward Declaration
+class BatchedTimeDerivative;
+
+template<>
+InputParameters validParams<BatchedTimeDerivative>();
+
+/**
+ * TimeDerivative evaluated for all quadrature points at once (see BatchedKernel).
+ */
+class BatchedTimeDerivative : public TimeKernel
+{
+public:
+  BatchedTimeDerivative(const std::string & name, InputParameters parameters);
+
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
+protected:
+  /**
+   * Not used: the residual is computed for all quadrature points at once.
+   */
+  virtual Real computeQpResidual();
+
+  bool _lumping;
+
+  /// Coefficients for all the quadrature points of the current element
+  QpBatch _batch;
+};
+
+#endif //BATCHEDTIMEDERIVATIVE_H
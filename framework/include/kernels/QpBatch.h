@@ -0,0 +1,90 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef QPBATCH_H
+#define QPBATCH_H
+
+#include "Moose.h"
+#include "MooseArray.h"
+#include "MooseVariableBase.h"
+
+// libMesh includes
+#include "libmesh/dense_vector.h"
+#include "libmesh/dense_matrix.h"
+
+/**
+ * Holds per quadrature point coefficients for all the quadrature points of an element and assembles
+ * residuals and Jacobians of the form:
+ *
+ *  R_i  = sum_qp JxW[qp] * coord[qp] * (value[qp] * test[i][qp] + grad_value[qp] * grad_test[i][qp])
+ *  K_ij = sum_qp JxW[qp] * coord[qp] * (phi_coef[qp] * phi[j][qp] * test[i][qp] + grad_phi_coef[qp] * grad_phi[j][qp] * grad_test[i][qp])
+ *
+ * with tight loops over contiguous arrays.  Only the coefficient arrays that were requested
+ * since the last call to reinit() take part in the assembly.
+ */
+class QpBatch
+{
+public:
+  QpBatch();
+
+  /**
+   * Prepare for a new element (or a new Jacobian block): no coefficients are active afterwards.
+   * @param n_qp The number of quadrature points on the current element
+   */
+  void reinit(unsigned int n_qp);
+
+  /// Coefficients multiplying test[i][qp] in the residual (zeroed and activated by this call)
+  std::vector<Real> & value();
+  /// Coefficients multiplying grad_test[i][qp] in the residual (zeroed and activated by this call)
+  std::vector<RealGradient> & gradValue();
+  /// Coefficients multiplying phi[j][qp] * test[i][qp] in the Jacobian (zeroed and activated by this call)
+  std::vector<Real> & phiCoef();
+  /// Coefficients multiplying grad_phi[j][qp] * grad_test[i][qp] in the Jacobian (zeroed and activated by this call)
+  std::vector<Real> & gradPhiCoef();
+
+  /**
+   * Add the residual built from the active residual coefficients into re.
+   */
+  void addResidual(DenseVector<Number> & re, const MooseArray<Real> & JxW, const MooseArray<Real> & coord,
+                   const VariableTestValue & test, const VariableTestGradient & grad_test);
+
+  /**
+   * Add the Jacobian built from the active Jacobian coefficients into ke.
+   */
+  void addJacobian(DenseMatrix<Number> & ke, const MooseArray<Real> & JxW, const MooseArray<Real> & coord,
+                   const VariableTestValue & test, const VariableTestGradient & grad_test,
+                   const VariablePhiValue & phi, const VariablePhiGradient & grad_phi);
+
+protected:
+  /// Fold JxW * coord into the active coefficients
+  void weight(const MooseArray<Real> & JxW, const MooseArray<Real> & coord);
+
+  unsigned int _n_qp;
+
+  std::vector<Real> _value;
+  std::vector<RealGradient> _grad_value;
+  std::vector<Real> _phi_coef;
+  std::vector<Real> _grad_phi_coef;
+
+  bool _has_value;
+  bool _has_grad_value;
+  bool _has_phi_coef;
+  bool _has_grad_phi_coef;
+
+  /// Scratch space holding the coefficients times the current test function
+  std::vector<Real> _test_work;
+  std::vector<RealGradient> _grad_test_work;
+};
+
+#endif //QPBATCH_H
@@ -46,7 +46,15 @@ protected:
    */
   virtual Real computeQpResidual();
 
+  /**
+   * Evaluates the function at all of the quadrature points of the element.
+   */
+  virtual void precalculateResidual();
+
   Function & _func;
+
+  /// Values of the function at the quadrature points
+  std::vector<Real> _func_values;
 };
 
 #endif //USERFORCINGFUNCTION_H
@@ -38,6 +38,11 @@ public:
   GenericFunctionMaterial(const std::string & name, InputParameters parameters);
 
 protected:
+  /**
+   * Evaluates each of the functions for all of the quadrature points at once.
+   */
+  virtual void computeProperties();
+
   virtual void computeQpProperties();
 
   std::vector<std::string> _prop_names;
@@ -47,6 +52,9 @@ protected:
 
   std::vector<MaterialProperty<Real> *> _properties;
   std::vector<Function *> _functions;
+
+  /// Values of one of the functions at the quadrature points
+  std::vector<Real> _values;
 };
 
 #endif //GENERICFUNCTIONMATERIAL_H
@@ -81,9 +81,28 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp) = 0;
 
+  /**
+   * Make this Property operate on n values of another Property starting at offset.  Our own values
+   * are kept aside until releaseView() is called.
+   *
+   * @param rhs The Property holding the values.
+   * @param offset The first value of rhs to use.
+   * @param n The number of values.
+   */
+  virtual void view (PropertyValue *rhs, const unsigned int offset, const unsigned int n) = 0;
+
+  /**
+   * Go back to operating on our own values after a call to view().
+   */
+  virtual void releaseView () = 0;
+
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
+
+  // save/restore n values starting at offset in a file
+  virtual void store(std::ostream & stream, const unsigned int offset, const unsigned int n) = 0;
+  virtual void load(std::istream & stream, const unsigned int offset, const unsigned int n) = 0;
 };
 
 template<>
@@ -109,8 +128,14 @@ template <typename T>
 class MaterialProperty : public PropertyValue
 {
 public:
+  MaterialProperty() :
+      _viewing(false)
+  {
+  }
+
   virtual ~MaterialProperty()
   {
+    releaseView();
     _value.release();
   }
 
@@ -165,6 +190,16 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp);
 
+  /**
+   * Make this Property operate on n values of another Property starting at offset.
+   */
+  virtual void view (PropertyValue *rhs, const unsigned int offset, const unsigned int n);
+
+  /**
+   * Go back to operating on our own values.
+   */
+  virtual void releaseView ();
+
   /**
    * Store the property into a binary stream
    */
@@ -175,6 +210,16 @@ public:
    */
   virtual void load(std::istream & stream);
 
+  /**
+   * Store n values starting at offset into a binary stream
+   */
+  virtual void store(std::ostream & stream, const unsigned int offset, const unsigned int n);
+
+  /**
+   * Load n values starting at offset from a binary stream
+   */
+  virtual void load(std::istream & stream, const unsigned int offset, const unsigned int n);
+
   /**
    * Friend helper function to handle scalar material property initializations
    * @param size - the size corresponding to the quadrature rule
@@ -198,6 +243,12 @@ private:
 
   /// Stored parameter value.
   MooseArray<T> _value;
+
+  /// Our own values while _value is a view into another Property
+  MooseArray<T> _own_value;
+
+  /// Whether or not _value is currently a view
+  bool _viewing;
 };
 
 
@@ -240,6 +291,34 @@ MaterialProperty<T>::qpCopy (const unsigned int to_qp, PropertyValue *rhs, const
   _value[to_qp] = libmesh_cast_ptr<const MaterialProperty<T>*>(rhs)->_value[from_qp];
 }
 
+template <typename T>
+inline void
+MaterialProperty<T>::view (PropertyValue *rhs, const unsigned int offset, const unsigned int n)
+{
+  mooseAssert(rhs != NULL, "Viewing NULL?");
+
+  if (!_viewing)
+  {
+    _own_value.shallowCopy(_value);
+    _viewing = true;
+  }
+
+  MooseArray<T> & rhs_value = libmesh_cast_ptr<MaterialProperty<T>*>(rhs)->_value;
+  mooseAssert(offset + n <= rhs_value.size(), "View out of range");
+  _value.shallowCopy(&rhs_value[0] + offset, n);
+}
+
+template <typename T>
+inline void
+MaterialProperty<T>::releaseView ()
+{
+  if (_viewing)
+  {
+    _value.shallowCopy(_own_value);
+    _viewing = false;
+  }
+}
+
 template<typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
@@ -256,6 +335,22 @@ MaterialProperty<T>::load(std::istream & stream)
     loadHelper(stream, _value[i], NULL);
 }
 
+template<typename T>
+inline void
+MaterialProperty<T>::store(std::ostream & stream, const unsigned int offset, const unsigned int n)
+{
+  for (unsigned int i = offset; i < offset + n; i++)
+    storeHelper(stream, _value[i], NULL);
+}
+
+template<typename T>
+inline void
+MaterialProperty<T>::load(std::istream & stream, const unsigned int offset, const unsigned int n)
+{
+  for (unsigned int i = offset; i < offset + n; i++)
+    loadHelper(stream, _value[i], NULL);
+}
+
 /**
  * Container for storing material properties
  */
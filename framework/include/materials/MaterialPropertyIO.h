@@ -26,6 +26,7 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <iostream>
 #include <fstream>
 
@@ -46,7 +47,17 @@ public:
   virtual void write(const std::string & file_name);
   virtual void read(const std::string & file_name);
 
+  /**
+   * Serialize the properties into a memory buffer (keyed by the file name) instead of writing the file
+   */
+  virtual void snapshot(const std::string & file_name, std::map<std::string, std::string> & buffers);
+
 protected:
+  /**
+   * Write the version and the properties to a stream
+   */
+  void store(std::ostream & out);
+
   FEProblem & _fe_problem;
   MooseMesh & _mesh;
   MaterialPropertyStorage & _material_props;
@@ -17,7 +17,7 @@
 
 #include "Moose.h"
 #include "MaterialProperty.h"
-#include "HashMap.h"
+#include "RangeAllocator.h"
 
 //libMesh
 #include "libmesh/elem.h"
@@ -34,6 +34,14 @@ class QpMap;
 /**
  * Stores the stateful material properties computed by materials.
  *
+ * The values of each stateful property are kept in a few large blocks (one PropertyValue per block, property and
+ * state) instead of one PropertyValue per element and side.  Every (element, side) pair owns a contiguous range of
+ * quadrature points inside a block.  swap() points the MaterialData properties at that range, so the materials
+ * compute straight into the storage, and shift() only rotates the three states.
+ *
+ * Blocks are never resized once created, so ranges handed out by swap() stay valid while other threads add
+ * elements.  The ranges of elements removed by coarsening are released and reused for new elements.
+ *
  * Thread-safe
  */
 class MaterialPropertyStorage
@@ -44,6 +52,12 @@ public:
 
   void releaseProperties();
 
+  /**
+   * Release the storage of all sides of an element so it can be reused by other elements.  Call this for
+   * elements that are being removed from the mesh.
+   */
+  void releaseProperties(const Elem & elem);
+
   /**
    * Creates storage for newly created elements from mesh Adaptivity.  Also, copies values from the parent qps to the new children.
    *
@@ -147,9 +161,15 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & props() { return *_props_elem; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOld() { return *_props_elem_old; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOlder() { return *_props_elem_older; }
+  /**
+   * Write the stateful property values of all stored elements and sides into a binary stream
+   */
+  void store(std::ostream & stream);
+
+  /**
+   * Read the stateful property values written by store().  The elements and sides must already have storage.
+   */
+  void load(std::istream & stream);
 
   bool hasProperty(const std::string & prop_name) const;
   unsigned int addProperty(const std::string & prop_name);
@@ -162,10 +182,69 @@ public:
   unsigned int getPropertyId (const std::string & prop_name);
 
 protected:
-  // indexing: [element][side]->material_properties
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_old;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_older;
+  /**
+   * The range of quadrature points owned by one (element, side) pair
+   */
+  struct Record
+  {
+    dof_id_type _elem_id;
+    unsigned int _side;
+    /// Block holding the values
+    unsigned int _block;
+    /// First quadrature point inside the block
+    unsigned int _offset;
+    unsigned int _n_qpoints;
+  };
+
+  /// Property values indexed by [block][stateful property id]
+  typedef std::vector<MaterialProperties> PropertyBlocks;
+
+  /**
+   * Find the record for an (element, side) pair
+   * @return The record index or -1 if there is no storage for this pair
+   */
+  int findRecord(dof_id_type elem_id, unsigned int side) const;
+
+  /**
+   * Find the record for an (element, side) pair and make sure it has room for n_qpoints values.
+   * Not thread safe - the caller has to hold the lock.
+   * @param material_data MaterialData object holding properties of the right types for new blocks
+   */
+  int initRecord(MaterialData & material_data, const Elem & elem, unsigned int side, unsigned int n_qpoints);
+
+  /**
+   * Give the range of a record back to the allocator and make the record available for reuse.
+   * Not thread safe - the caller has to hold the lock.
+   */
+  void releaseRecord(int record);
+
+  /**
+   * Copy the values of one quadrature point in all states
+   */
+  void qpCopy(const Record & to, unsigned int to_qp, MaterialPropertyStorage & from_storage, const Record & from, unsigned int from_qp);
+
+  /// Current, old and older property values (shift() rotates these)
+  PropertyBlocks * _props_elem;
+  PropertyBlocks * _props_elem_old;
+  PropertyBlocks * _props_elem_older;
+
+  /// Hands out the quadrature point ranges inside the blocks
+  RangeAllocator _allocator;
+
+  /// (element, side) ranges
+  std::vector<Record> _records;
+
+  /// Released entries of _records
+  std::vector<int> _free_records;
+
+  /// First entry in _elem_sides for each element id (-1 when the element has no storage)
+  std::vector<int> _elem_slot;
+
+  /// For each element with storage: the number of sides followed by a record index (or -1) per side
+  std::vector<int> _elem_sides;
+
+  /// Released entries of _elem_sides, by number of sides
+  std::map<unsigned int, std::vector<int> > _free_elem_sides;
 
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblem - should be useful when we will use material properties from
@@ -190,8 +269,6 @@ protected:
   std::vector<unsigned int> _stateful_prop_id_to_prop_id;
 
   unsigned int addPropertyId (const std::string & prop_name);
-
-  void sizeProps(MaterialProperties & mp, unsigned int size);
 };
 
 
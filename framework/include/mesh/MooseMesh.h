@@ -295,6 +295,15 @@ public:
    */
   void update();
 
+  /**
+   * Renumbers the elements of a serial mesh along a reverse Cuthill-McKee or space-filling curve
+   * ordering, chosen by the "renumbering" parameter, and the nodes in the order the elements first
+   * reference them.  The element and node loops and the DOF numbering follow the new ids.  prepare()
+   * calls this before the boundary lists and the node to element map are built, except when
+   * recovering since the checkpointed mesh is already renumbered.
+   */
+  void renumberForLocality();
+
 #ifdef LIBMESH_ENABLE_AMR
   /**
    * Returns the level of uniform refinement requested (zero if AMR is disabled).
@@ -334,6 +343,12 @@ public:
   void setPatchSize(const unsigned int patch_size);
   unsigned int getPatchSize();
 
+  /**
+   * Getter/setter for the patch_update_strategy parameter.
+   */
+  void setPatchUpdateStrategy(Moose::PatchUpdateType patch_update_strategy);
+  Moose::PatchUpdateType getPatchUpdateStrategy();
+
   /**
    * Implicit conversion operator from MooseMesh -> libMesh::MeshBase.
    */
@@ -638,6 +653,11 @@ protected:
   MooseEnum _partitioner_name;
   bool _partitioner_overridden;
 
+  /// The element and node renumbering applied by prepare(): none, rcm, hilbert or morton
+  MooseEnum _renumbering;
+  /// Whether the mesh has been renumbered, or was recovered from a renumbered mesh
+  bool _is_renumbered;
+
   /// Convenience enums
   enum {
     X = 0,
@@ -738,6 +758,9 @@ protected:
   /// The number of nodes to consider in the NearestNode neighborhood.
   unsigned int _patch_size;
 
+  /// How the NearestNode neighborhoods are kept up to date
+  Moose::PatchUpdateType _patch_update_strategy;
+
   /// file_name iff this mesh was read from a file
   std::string _file_name;
 
@@ -839,6 +862,24 @@ private:
    * @param child - the id of the child element
    * @param child_side - The id of the child's side
    */
+  /**
+   * Orders the elements in reverse Cuthill-McKee order over their face neighbors.  Each connected
+   * component starts from a pseudo-peripheral element.
+   */
+  void rcmElementOrder(std::vector<Elem *> & elems) const;
+
+  /**
+   * Orders the elements by the Hilbert (or Morton, if hilbert=false) key of their centroids in the
+   * bounding box of the mesh.
+   */
+  void sfcElementOrder(std::vector<Elem *> & elems, bool hilbert) const;
+
+  /**
+   * Moves each element (or node, if nodes=true) from id i to new_ids[i] with renumber_elem()
+   * (renumber_node()), following the cycles of the permutation through the free id spare_id.
+   */
+  void permuteIds(const std::vector<unsigned int> & new_ids, unsigned int spare_id, bool nodes);
+
   void findAdaptivityQpMaps(const Elem * template_elem,
                             QBase & qrule,
                             QBase & qrule_face,
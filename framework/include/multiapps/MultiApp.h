@@ -59,6 +59,12 @@ public:
    */
   virtual void solveStep(Real dt, Real target_time) = 0;
 
+  /**
+   * Gets called on every processor after all of the Apps have been solved.
+   * Gathers the solve times of the Apps from the processors they are on.
+   */
+  virtual void postSolve();
+
   /**
    * @param app The global app number to get the Executioner for
    * @return The Executioner associated with that App.
@@ -131,6 +137,13 @@ public:
    */
   unsigned int firstLocalApp() { return _first_local_app; }
 
+  /**
+   * Map a local App number to the global number.
+   * @param local_app The local app number.
+   * @return The global app number.
+   */
+  unsigned int localAppToGlobal(unsigned int local_app) { return _local_apps[local_app]; }
+
   /**
    * Whether or not this MultiApp has an app on this processor.
    */
@@ -150,6 +163,13 @@ public:
    */
   Point position(unsigned int app) { return _positions[app]; }
 
+  /**
+   * The wall time the solve of a global App took on the last step (on the root processor of the App)
+   * @param app The global app number
+   * @return The time in seconds (0 if the App was not solved on the last step)
+   */
+  Real appSolveTime(unsigned int app) const { return _app_solve_times[app]; }
+
   /**
    * "Reset" the App corresponding to the global App number
    * passed in.  "Reset" means that the App will be deleted
@@ -241,6 +261,12 @@ protected:
   /// The number of the first app on this processor
   unsigned int _first_local_app;
 
+  /// The global numbers of the apps on this processor, indexed by local app number
+  std::vector<unsigned int> _local_apps;
+
+  /// The wall time of the solve of each global app on the last step
+  std::vector<Real> _app_solve_times;
+
   /// The comm that was passed to us specifying our pool of processors
   MPI_Comm _orig_comm;
 
@@ -73,7 +73,49 @@ public:
    */
   virtual void resetApp(unsigned int global_app, Real time);
 
+  /**
+   * Gathers the solve times of the Apps and, when load balancing, moves Apps between processors.
+   */
+  virtual void postSolve();
+
 private:
+  /**
+   * Advance one local App one timestep.
+   *
+   * @param i The local app number
+   * @param dt The timestep of the master
+   * @param target_time The (global) time the App should get to
+   */
+  void solveApp(unsigned int i, Real dt, Real target_time);
+
+  /**
+   * Advance all of the local Apps one timestep at the same time, a block of Apps on each of libMesh::n_threads()
+   * threads.  The solver of every App is set up before the threads start.  Each App writes to its own output
+   * stream, which is written out in App order once they are all done, and logs into its own perf log.
+   */
+  void solveAppsConcurrently(Real dt, Real target_time);
+
+  /**
+   * The perf log of a local App when it is solved concurrently with the others.
+   *
+   * @param i The local app number
+   */
+  PerfLog & appPerfLog(unsigned int i);
+
+  /**
+   * Work out a new processor for each App from the measured solve times and move the Apps there.
+   */
+  void balanceApps();
+
+  /**
+   * Move Apps between processors.  The state of each App is backed up, sent to its new processor
+   * and restored into a freshly built copy of the App.
+   *
+   * @param owners The processor each global App is on now
+   * @param new_owners The processor each global App should be on
+   */
+  void migrateApps(const std::vector<unsigned int> & owners, const std::vector<unsigned int> & new_owners);
+
   /**
    * Setup the executioner for the local app.
    *
@@ -99,6 +141,18 @@ private:
   bool _catch_up;
   Real _max_catch_up_steps;
 
+  /// Whether or not to solve the local Apps concurrently on threads
+  bool _concurrent_apps;
+
+  /// The perf log of each global App solved concurrently on this processor
+  std::map<unsigned int, PerfLog *> _app_perf_logs;
+
+  /// Whether or not to move Apps between processors to balance their solve times
+  bool _load_balance;
+
+  /// How far above the average load a processor can be before the Apps are rebalanced
+  Real _load_balance_tolerance;
+
   /// Is it our first time through the execution loop?
   bool & _first;
 
@@ -110,6 +164,8 @@ private:
 
   std::vector<std::map<std::string, unsigned int> > _output_file_numbers;
 
+  friend class SolveAppsThread;
+
 };
 
 #endif // TRANSIENTMULTIAPP_H
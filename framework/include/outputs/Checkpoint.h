@@ -22,6 +22,9 @@
 #include "MaterialPropertyIO.h"
 #include "RestartableDataIO.h"
 
+// System includes
+#include <pthread.h>
+
 // Forward declarations
 class Checkpoint;
 struct CheckpointFileNames;
@@ -97,6 +100,22 @@ protected:
 
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Blocks until the background write of the previous checkpoint (if any) has completed
+   */
+  void waitForWrite();
+
+  /**
+   * Writes the buffered files of a checkpoint and then removes the old checkpoint files, this runs
+   * on the background thread
+   */
+  void writeBuffers();
+
+  /**
+   * Entry point of the background thread
+   */
+  static void * writeThread(void * checkpoint);
+
 private:
 
   /// Max no. of output files to store
@@ -125,6 +144,24 @@ private:
 
   /// Vector of checkpoint filename structures
   std::vector<CheckpointFileNames> _file_names;
+
+  /// True if the restartable and material property data are written by a background thread
+  bool _async;
+
+  /// True while the background thread is writing a checkpoint
+  bool _writing;
+
+  /// The background thread
+  pthread_t _write_thread;
+
+  /// Contents of the files being written by the background thread, keyed by the file name
+  std::map<std::string, std::string> _write_buffers;
+
+  /// The files of the checkpoint being written by the background thread
+  CheckpointFileNames _write_files;
+
+  /// Error message from the background thread
+  std::string _write_error;
 };
 
 #endif //CHECKPOINT_H
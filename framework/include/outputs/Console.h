@@ -112,6 +112,11 @@ protected:
    */
   virtual void outputPostprocessors();
 
+  /**
+   * Prints the FE shape function cache statistics summed over the threads
+   */
+  void outputFECacheInfo();
+
   /**
    * Setups up PETSc to output the nonlinear/linear residuals
    */
@@ -185,6 +190,9 @@ protected:
   /// State for the performance log header information
   bool _perf_header;
 
+  /// Flag for printing the FE shape function cache statistics
+  bool _fe_cache_log;
+
   /// Width used for printing simulation information
   static const unsigned int _field_width = 25;
 
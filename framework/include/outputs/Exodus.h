@@ -57,6 +57,12 @@ public:
    */
   virtual void outputSetup();
 
+  /**
+   * Append to the existing file at the next output, as when recovering.  This is used when the
+   * App has been rebuilt and restored from a backup of the one that wrote the file.
+   */
+  void appendToFile() { _recovering = true; }
+
 protected:
 
   /**
@@ -123,7 +129,7 @@ private:
   /// Count of outputs per exodus file
   unsigned int & _exodus_num;
 
-  /// Flag indicating MOOSE is recovering via --recover command-line option
+  /// Flag indicating MOOSE is recovering via --recover command-line option (or appendToFile() was called)
   bool _recovering;
 };
 
@@ -115,6 +115,11 @@ public:
    */
   std::map<std::string, unsigned int> getFileNumbers();
 
+  /**
+   * Calls the appendToFile method for every Exodus output object
+   */
+  void appendToFiles();
+
   /**
    * Stores the common InputParameters object
    * @param params_ptr A pointer to the common parameters object to be stored
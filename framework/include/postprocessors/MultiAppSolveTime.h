@@ -0,0 +1,50 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MULTIAPPSOLVETIME_H
+#define MULTIAPPSOLVETIME_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class MultiAppSolveTime;
+class MultiApp;
+
+template<>
+InputParameters validParams<MultiAppSolveTime>();
+
+/**
+ * The wall time the last solve of one of the Apps in a MultiApp took.
+ */
+class MultiAppSolveTime : public GeneralPostprocessor
+{
+public:
+  MultiAppSolveTime(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  /**
+   * This will return the solve time of the App.
+   */
+  virtual Real getValue();
+
+protected:
+  MultiApp * _multi_app;
+
+  /// The global app number
+  unsigned int _app;
+};
+
+#endif // MULTIAPPSOLVETIME_H
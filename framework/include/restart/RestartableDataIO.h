@@ -19,8 +19,10 @@
 
 #include <string>
 #include <list>
+#include <map>
 
 class RestartableDatas;
+class RestartableDataValue;
 
 class FEProblem;
 
@@ -39,12 +41,33 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Serialize the restartable data into memory buffers (keyed by the file name) instead of writing
+   * the files, so they can be written later on.
+   */
+  void snapshotRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::map<std::string, std::string> & buffers);
+
   /**
    * Read the restartable data.
    */
   void readRestartableData(std::string base_file_name, RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
 private:
+  /**
+   * The name of the file holding the restartable data of a thread on this processor
+   */
+  std::string fileName(const std::string & base_file_name, unsigned int tid);
+
+  /**
+   * Write the header and the restartable data of a thread to a stream.  The values are streamed
+   * directly, the header holds the 64 bit offset and size of each one so they can be read
+   * individually.
+   */
+  void serializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::ostream & out);
+
+  /// The version of the restartable data files
+  static const unsigned int file_version;
+
   /// Reference to a FEProblem being restarted
   FEProblem & _fe_problem;
 };
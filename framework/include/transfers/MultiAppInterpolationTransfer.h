@@ -16,6 +16,10 @@
 #define MULTIAPPINTERPOLATIONTRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
+
+// libMesh
+#include "libmesh/radial_basis_interpolation.h"
 
 class MooseVariable;
 class MultiAppInterpolationTransfer;
@@ -31,20 +35,25 @@ class MultiAppInterpolationTransfer :
 {
 public:
   MultiAppInterpolationTransfer(const std::string & name, InputParameters parameters);
-  virtual ~MultiAppInterpolationTransfer() {}
+  virtual ~MultiAppInterpolationTransfer();
 
   virtual void execute();
 
 protected:
   /**
-   * Return the nearest node to the point p.
-   * @param p The point you want to find the nearest node to.
-   * @param distance This will hold the distance between the returned node and p
-   * @param nodes_begin - iterator to the beginning of the node list
-   * @param nodes_end - iterator to the end of the node list
-   * @return The Node closest to point p.
+   * Gather the source points and values from every processor and get ready to interpolate from them.
+   * The inverse distance search tree is only rebuilt when the source points have moved.
+   * @param src_pts The local source points (these are consumed)
+   * @param src_vals The local source values (these are consumed)
+   */
+  void prepareSource(std::vector<Point> & src_pts, std::vector<Number> & src_vals);
+
+  /**
+   * Interpolate the source values to a set of points all at once.
+   * @param pts The points to interpolate to
+   * @param vals This will hold the value at each point
    */
-  Node * getNearestNode(const Point & p, Real & distance, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
+  void interpolate(const std::vector<Point> & pts, std::vector<Number> & vals);
 
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
@@ -56,6 +65,15 @@ protected:
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// Search tree over the gathered source points, kept between transfers
+  KDTree _source_tree;
+
+  /// The gathered source values, in the same order as the tree points
+  std::vector<Number> _source_vals;
+
+  /// The radial basis interpolation, rebuilt on each transfer
+  RadialBasisInterpolation<LIBMESH_DIM> * _radial_basis;
 };
 
 #endif /* MULTIAPPVARIABLEVALUESAMPLEPOSTPROCESSORTRANSFER_H */
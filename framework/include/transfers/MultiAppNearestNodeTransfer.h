@@ -16,6 +16,7 @@
 #define MULTIAPPNEARESTNODETRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 class MooseVariable;
 class MultiAppNearestNodeTransfer;
@@ -37,14 +38,34 @@ public:
 
 protected:
   /**
-   * Return the nearest node to the point p.
-   * @param p The point you want to find the nearest node to.
-   * @param distance This will hold the distance between the returned node and p
+   * A KD-tree over the nodes of one source mesh.
+   */
+  struct SourceTree
+  {
+    /// The nodes the tree was built over, in tree index order
+    std::vector<Node *> _nodes;
+
+    /// The tree itself
+    KDTree _tree;
+  };
+
+  /**
+   * Get the tree for a source mesh, rebuilding it only if the nodes have changed or moved.
+   * @param id 0 for the master mesh, otherwise the global app number
    * @param nodes_begin - iterator to the beginning of the node list
    * @param nodes_end - iterator to the end of the node list
-   * @return The Node closest to point p.
    */
-  Node * getNearestNode(const Point & p, Real & distance, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
+  SourceTree & sourceTree(unsigned int id, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
+
+  /**
+   * Find the nearest source node to each point.  The result (and the distances in _cached_distances[id])
+   * are kept so they can be reused when the meshes are fixed.
+   * @param id The app number the points belong to
+   * @param source The tree to search
+   * @param points The points to find the nearest nodes to
+   * @return The nearest node to each point
+   */
+  const std::vector<Node *> & nearestNodes(unsigned int id, const SourceTree & source, const std::vector<Point> & points);
 
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
@@ -55,11 +76,14 @@ protected:
   /// If true then node connections will be cached
   bool _fixed_meshes;
 
-  /// Used to cache nodes
-  std::map<unsigned int, Node *> _node_map;
+  /// The source mesh trees, 0 for the master mesh or indexed by global app number
+  std::map<unsigned int, SourceTree> _source_trees;
+
+  /// Used to cache the nearest nodes, indexed by global app number
+  std::map<unsigned int, std::vector<Node *> > _cached_nodes;
 
-  /// Used to cache distances
-  std::map<unsigned int, Real> _distance_map;
+  /// Used to cache the distances to the nearest nodes, indexed by global app number
+  std::map<unsigned int, std::vector<Real> > _cached_distances;
 };
 
 #endif /* MULTIAPPVARIABLEVALUESAMPLEPOSTPROCESSORTRANSFER_H */
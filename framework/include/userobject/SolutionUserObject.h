@@ -4,6 +4,7 @@
 #include "GeneralUserObject.h"
 #include "libmesh/exodusII_io.h"
 #include "MooseUtils.h"
+#include "MooseArray.h"
 
 // Forward Declarations
 namespace libMesh
@@ -44,6 +45,15 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const std::string & var_name) const;
 
+  /**
+   * Returns the values at a set of locations for a variable (see SolutionFunction)
+   * @param t The time at which to extract (not used, it is handled automatically when reading the data)
+   * @param p The locations at which to return a value
+   * @param var_name The variable that is desired
+   * @param values The values of the variable at the locations are returned here
+   */
+  virtual void pointValue(Real t, const MooseArray<Point> & p, const std::string & var_name, std::vector<Real> & values) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
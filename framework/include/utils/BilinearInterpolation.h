@@ -49,13 +49,31 @@ public:
    */
   Real sample(Real xcoord, Real ycoord);
 
-  void getNeighborIndices(std::vector<Real> inArr, Real x ,int& lowerX ,int& upperX );
+  /**
+   * Sample the fit at several points at once
+   * @param xcoords The x coordinates of the points
+   * @param ycoords The y coordinates of the points
+   * @param values The values of the fit are returned here
+   */
+  void sample(const std::vector<Real> & xcoords, const std::vector<Real> & ycoords, std::vector<Real> & values);
+
+  void getNeighborIndices(const std::vector<Real> & inArr, Real x ,int& lowerX ,int& upperX );
 
 private:
 
+  /**
+   * Same as above but the interval search starts from the interval passed in as hint,
+   * which is updated with the interval found.
+   */
+  void getNeighborIndices(const std::vector<Real> & inArr, Real x ,int& lowerX ,int& upperX, unsigned int & hint);
+
   std::vector<Real> _xAxis;
   std::vector<Real> _yAxis;
   ColumnMajorMatrix _zSurface;
+
+  /// The x and y intervals found by the last sample, checked first by the next one
+  unsigned int _last_x_interval;
+  unsigned int _last_y_interval;
   static int _file_number;
 };
 
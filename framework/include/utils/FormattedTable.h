@@ -23,6 +23,7 @@
 #include "libmesh/exodusII_io.h"
 
 #include <string>
+#include <vector>
 #include <map>
 #include <set>
 #include <ostream>
@@ -62,7 +63,26 @@ public:
 
   void clear();
 
-  const std::map<Real, std::map<std::string, Real> > & getData() const { return _data; }
+  /**
+   * Limit the number of rows kept in memory, zero (the default) keeps every row. The table holds
+   * between max_rows and twice that many rows, the oldest are dropped in one go.  Rows are only
+   * dropped once they have been written to the files the table is streamed to (see printCSV() and
+   * makeGnuplot()); when these files have to be rewritten the dropped rows are read back from them.
+   */
+  void setMaxRows(unsigned int max_rows) { _max_rows = max_rows; }
+
+  /**
+   * The independent variable (normally time) of each row held in memory, in increasing order
+   */
+  const std::vector<Real> & getTimes() const { return _times; }
+
+  /**
+   * Retrieve the columns that have a value in a row along with these values
+   * @param row The index of the row in getTimes()
+   * @param names The names of the columns, in alphabetical order
+   * @param values The values of the columns
+   */
+  void getRowData(unsigned int row, std::vector<std::string> & names, std::vector<Real> & values) const;
 
   /**
    * Methods for dumping the table to the stream - either by filename or by stream handle.  If
@@ -75,7 +95,9 @@ public:
   void printTable(const std::string & file_name);
 
   /**
-   * Method for dumping the table to a csv file - opening and closing the file handle is handled
+   * Method for dumping the table to a csv file - opening and closing the file handle is handled.
+   * Only the rows added since the previous call are appended to the file, it is rewritten only if
+   * the set of columns changed or a row that was already written has been modified.
    */
   void printCSV(const std::string & file_name, int interval=1);
 
@@ -86,17 +108,20 @@ public:
   static MooseEnum getWidthModes();
 
 protected:
+  /// Iterator over the columns in the order they are printed
+  typedef std::map<std::string, unsigned int>::iterator ColumnIterator;
+
   void printTablePiece(std::ostream & out, unsigned int last_n_entries, std::map<std::string, unsigned short> & col_widths,
-                       std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end);
+                       ColumnIterator & col_begin, ColumnIterator & col_end);
 
   void printOmittedRow(std::ostream & out, std::map<std::string, unsigned short> & col_widths,
-                       std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end) const;
+                       ColumnIterator & col_begin, ColumnIterator & col_end) const;
   void printRowDivider(std::ostream & out, std::map<std::string, unsigned short> & col_widths,
-                       std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end) const;
+                       ColumnIterator & col_begin, ColumnIterator & col_end) const;
 
   void printNoDataRow(char intersect_char, char fill_char,
                       std::ostream & out, std::map<std::string, unsigned short> & col_widths,
-                      std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end) const;
+                      ColumnIterator & col_begin, ColumnIterator & col_end) const;
 
 
   /**
@@ -105,14 +130,66 @@ protected:
   unsigned short getTermWidth(bool use_environment) const;
 
   /**
-   * Data structure for the console table
-   * The first map creates an association from the independent variable (normally time)
-   * to a map of dependent variables and their associated values if they exist
+   * Bookkeeping for a file the table is streamed to
+   */
+  struct OutputState
+  {
+    OutputState();
+
+    /// The key of the last row written to (or skipped for) the file
+    Real last_key;
+
+    /// The number of rows written to (or skipped for) the file, used for the output interval
+    unsigned long n_rows;
+
+    /// True when rows already in the file have changed and the file must be rewritten
+    bool rewrite;
+
+    /// True once the table has been written to the file
+    bool active;
+  };
+
+  /**
+   * Flags the files for a rewrite if the row being changed has already been written to them
+   */
+  void rowChanged(Real time);
+
+  /**
+   * Returns the index of the row for the given time, inserting it if needed
    */
-  std::map<Real, std::map<std::string, Real> > _data;
+  unsigned int addRow(Real time);
 
-  /// The set of column names updated when data is inserted through the setter methods
-  std::set<std::string> _column_names;
+  /**
+   * Returns the id of the column with the given name, inserting it if needed
+   */
+  unsigned int addColumn(const std::string & name);
+
+  /**
+   * Reads the rows that were dropped from memory back from a file written by this table
+   * @param file_name The file to read
+   * @param separator The character between the columns
+   */
+  void loadRows(const std::string & file_name, char separator);
+
+  /**
+   * Drops the oldest rows that have been written to all of the files once there are twice _max_rows
+   */
+  void trimRows();
+
+  /**
+   * The table is stored by column: the independent variable (normally time) of each row and,
+   * for each column, a dense array of values with one entry per row.
+   */
+  std::vector<Real> _times;
+
+  /// The id of each column, in the order the columns are printed
+  std::map<std::string, unsigned int> _column_ids;
+
+  /// The values of each column (indexed by column id, then row)
+  std::vector<std::vector<Real> > _columns;
+
+  /// Whether a value was added for each entry of _columns, missing values are printed as zero
+  std::vector<std::vector<unsigned char> > _has_value;
 
   /// The single cell width used for all columns in the table
   static const unsigned short _column_width;
@@ -127,6 +204,21 @@ protected:
   /// The last key value inserted
   Real _last_key;
 
+  /// The maximum number of rows kept in memory (zero for no limit)
+  unsigned int _max_rows;
+
+  /// The number of rows dropped from memory, they are the first rows of the output files
+  unsigned int _n_trimmed;
+
+  /// State of the csv file
+  OutputState _csv_state;
+
+  /// The position of the blank line that terminates the csv file
+  std::streampos _csv_end;
+
+  /// State of the gnuplot data file
+  OutputState _gnuplot_state;
+
   friend void dataStore<FormattedTable>(std::ostream & stream, FormattedTable & table, void * context);
   friend void dataLoad<FormattedTable>(std::istream & stream, FormattedTable & v, void * context);
 };
@@ -0,0 +1,112 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+#include <vector>
+
+/**
+ * A static KD-tree over a set of points used to answer nearest neighbor queries in O(log N)
+ * instead of looking at every point.
+ *
+ * The tree is built once with build() and can be rebuilt (reusing its memory) when the points move.
+ * Queries are const and can be made from several threads at once.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param max_leaf_size The largest number of points kept in a leaf of the tree
+   */
+  KDTree(unsigned int max_leaf_size = 10);
+
+  virtual ~KDTree();
+
+  /**
+   * (Re)build the tree over a set of points.  The points are copied.
+   */
+  void build(const std::vector<Point> & points);
+
+  /**
+   * Find the n nearest points to a query point.
+   *
+   * @param query The point to search around
+   * @param n The number of points to find (fewer are returned if the tree holds fewer points)
+   * @param indices The indices (into the points passed to build()) of the nearest points, nearest first
+   * @param distances The distances to those points
+   */
+  void neighborSearch(const Point & query, unsigned int n, std::vector<unsigned int> & indices, std::vector<Real> & distances) const;
+
+  /**
+   * Find the nearest point to each of a set of query points.  The queries are split between threads.
+   *
+   * @param queries The points to search around
+   * @param indices The index (into the points passed to build()) of the nearest point to each query
+   * @param distances The distance to the nearest point for each query
+   */
+  void nearestNeighbors(const std::vector<Point> & queries, std::vector<unsigned int> & indices, std::vector<Real> & distances) const;
+
+  /**
+   * The number of points in the tree
+   */
+  unsigned int numberOfPoints() const { return _points.size(); }
+
+  /**
+   * The points the tree was built over
+   */
+  const std::vector<Point> & points() const { return _points; }
+
+protected:
+  /**
+   * A node of the tree.  Leaves hold the points _index[_begin] to _index[_end - 1].
+   */
+  struct KDNode
+  {
+    unsigned int _begin;
+    unsigned int _end;
+    /// Children (-1 for a leaf)
+    int _left;
+    int _right;
+    /// Splitting direction and coordinate
+    unsigned int _dim;
+    Real _split;
+  };
+
+  /// Recursively build the subtree holding _index[begin] to _index[end - 1]
+  int buildNode(unsigned int begin, unsigned int end);
+
+  /// Recursively search a subtree, the candidates are kept as a max heap on squared distance
+  void searchNode(int node, const Point & query, unsigned int n, std::vector<std::pair<Real, unsigned int> > & heap) const;
+
+  /// Largest number of points in a leaf
+  unsigned int _max_leaf_size;
+
+  /// The points the tree was built over
+  std::vector<Point> _points;
+
+  /// Permutation of the points so that each node holds a contiguous range
+  std::vector<unsigned int> _index;
+
+  /// The nodes of the tree (the root is the first one)
+  std::vector<KDNode> _nodes;
+};
+
+#endif // KDTREE_H
@@ -36,7 +36,8 @@ public:
                       const std::vector<double> & Y);
   LinearInterpolation() :
     _x(std::vector<double>()),
-    _y(std::vector<double>()) {}
+    _y(std::vector<double>()),
+    _last_interval(0) {}
 
   virtual ~LinearInterpolation()
     {}
@@ -48,6 +49,7 @@ public:
   {
     _x = X;
     _y = Y;
+    _last_interval = 0;
     errorCheck();
   }
 
@@ -65,6 +67,20 @@ public:
    */
   double sampleDerivative(double x) const;
 
+  /**
+   * Sample the fit at several values of the independent variable at once
+   * @param x The values of the independent variable
+   * @param y The values of the dependent variable are returned here
+   */
+  void sample(const std::vector<double> & x, std::vector<double> & y) const;
+
+  /**
+   * Sample the derivative of the fit at several values of the independent variable at once
+   * @param x The values of the independent variable
+   * @param dy The derivatives are returned here
+   */
+  void sampleDerivative(const std::vector<double> & x, std::vector<double> & dy) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -86,9 +102,18 @@ public:
 
 private:
 
+  /**
+   * Index of the interval containing x, which must be strictly inside the table.
+   */
+  unsigned int findInterval(double x) const;
+
   std::vector<double> _x;
   std::vector<double> _y;
 
+  /// The interval found by the last lookup, checked first by the next one.  Objects
+  /// holding a LinearInterpolation are per-thread so this does not need a lock.
+  mutable unsigned int _last_interval;
+
   static int _file_number;
 };
 
@@ -156,6 +156,15 @@ public:
    */
   void shallowCopy(std::vector<T> & rhs);
 
+  /**
+   * Doesn't actually make a copy of the data.
+   *
+   * Makes _this_ object operate on the size entries starting at data.  The same warnings as
+   * for the std::vector version apply - _this_ object must never be resized past size or
+   * released while it points at someone else's memory.
+   */
+  void shallowCopy(T * data, unsigned int size);
+
   /**
    * Actual operator=... really does make a copy of the data
    *
@@ -304,6 +313,16 @@ MooseArray<T>::shallowCopy(std::vector<T> & rhs)
   _allocated_size = rhs.size();
 }
 
+template<typename T>
+inline
+void
+MooseArray<T>::shallowCopy(T * data, unsigned int size)
+{
+  _data = data;
+  _size = size;
+  _allocated_size = size;
+}
+
 template<typename T>
 inline
 MooseArray<T> &
@@ -118,6 +118,12 @@ enum CoordinateSystemType
   COORD_RSPHERICAL
 };
 
+enum PatchUpdateType
+{
+  PATCH_UPDATE_NEVER,
+  PATCH_UPDATE_AUTO
+};
+
 enum PPSOutputType
 {
   PPS_OUTPUT_NONE,
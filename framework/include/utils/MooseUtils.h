@@ -72,6 +72,18 @@ namespace MooseUtils
    */
   bool hasExtension(const std::string & filename, std::string ext);
 
+  /**
+   * Find the interval of a sorted table containing a value, i.e. the index i such that
+   * x[i] <= v < x[i+1].  The interval passed in as a hint and the one following it are
+   * checked first (the common case of monotonically advancing time), otherwise a binary
+   * search is used.  Values outside of the table are clamped to the first or last interval.
+   * @param x The strictly increasing table (must have at least 2 entries)
+   * @param v The value to look for
+   * @param hint The interval to check first, it is updated with the result
+   * @return The index of the lower end of the interval
+   */
+  unsigned int findInterval(const std::vector<double> & x, double v, unsigned int & hint);
+
   /**
    * This routine is a simple helper function for searching a map by values instead of keys
    */
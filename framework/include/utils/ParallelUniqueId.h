@@ -22,6 +22,7 @@
 
 #ifdef LIBMESH_HAVE_TBB_API
 #include "tbb/concurrent_queue.h"
+#include "tbb/enumerable_thread_specific.h"
 #include "tbb/tbb_thread.h"
 #endif
 
@@ -34,7 +35,20 @@ public:
   ParallelUniqueId()
   {
 #ifdef LIBMESH_HAVE_TBB_API
-    ids.pop(id);
+    /**
+     * A thread that already holds an id keeps using it, i.e. a thread solving an App of a MultiApp
+     * concurrently with other Apps holds an id for as long as it solves and the threaded loops of
+     * that App run on it with the same id.
+     */
+    unsigned int & held_id = held_ids.local();
+    _holder = held_id == 0;
+    if (_holder)
+    {
+      ids.pop(id);
+      held_id = id + 1;
+    }
+    else
+      id = held_id - 1;
 #else
 #ifdef LIBMESH_HAVE_PTHREAD
     id = Threads::pthread_unique_id();
@@ -47,7 +61,11 @@ public:
   ~ParallelUniqueId()
   {
 #ifdef LIBMESH_HAVE_TBB_API
-    ids.push(id);
+    if (_holder)
+    {
+      held_ids.local() = 0;
+      ids.push(id);
+    }
 #endif
   }
 
@@ -80,7 +98,13 @@ public:
 
 protected:
 #ifdef LIBMESH_HAVE_TBB_API
+  /// Whether this object took the id from the pool, rather than the thread already holding one
+  bool _holder;
+
   static tbb::concurrent_bounded_queue<unsigned int> ids;
+
+  /// The id held by each thread plus one, zero if it holds none
+  static tbb::enumerable_thread_specific<unsigned int> held_ids;
 #endif
 
   static bool initialized;
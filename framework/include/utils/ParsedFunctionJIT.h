@@ -0,0 +1,149 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PARSEDFUNCTIONJIT_H
+#define PARSEDFUNCTIONJIT_H
+
+#include "Moose.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Compiles a function written in the fparser syntax into native code.
+ *
+ * The expression is parsed into a tree and translated into C++ that computes the value
+ * and the derivatives with respect to x, y, z and t (forward mode automatic differentiation).
+ * The C++ is compiled into a shared library with the compiler found at run time
+ * ($MOOSE_JIT_CXX, "c++" by default) and loaded with dlopen().  Libraries are cached on disk
+ * ($MOOSE_JIT_CACHE, $HOME/.jitcache by default, which must be owned by the user and writable
+ * only by them) under a hash of the generated code, so an expression is compiled only once.
+ * compile() must be called on all of the processors: the first one compiles and the others load
+ * the library from the cache.
+ *
+ * compile() returns false when the expression uses syntax that is not supported here
+ * or when no compiler is available; callers are expected to fall back to fparser.
+ */
+class ParsedFunctionJIT
+{
+public:
+  /**
+   * @param expression The function in the fparser syntax
+   * @param vars The names of the variables used in the expression in addition to x, y, z and t
+   */
+  ParsedFunctionJIT(const std::string & expression, const std::vector<std::string> & vars);
+  virtual ~ParsedFunctionJIT();
+
+  /**
+   * Parse, compile and load the expression.
+   * @return true if the native code is ready to be used
+   */
+  bool compile();
+
+  /**
+   * Whether or not the native code is ready to be used
+   */
+  bool compiled() const { return _value_fn != NULL; }
+
+  /**
+   * Evaluate the function.
+   * @param in The values of x, y, z, t followed by the values of the variables
+   */
+  Real value(const Real * in) const { return _value_fn(in); }
+
+  /**
+   * Evaluate the function and its derivatives.
+   * @param in The values of x, y, z, t followed by the values of the variables
+   * @param out The value, d/dx, d/dy, d/dz and d/dt are returned here
+   */
+  void derivatives(const Real * in, Real * out) const { _derivatives_fn(in, out); }
+
+  /**
+   * The reason compile() failed
+   */
+  const std::string & error() const { return _error; }
+
+protected:
+  /// A node of the expression tree
+  struct Node
+  {
+    Node() : value(0), var(0) {}
+
+    /// The operator or function name, "num" for a number and "var" for a variable
+    std::string op;
+    /// The value of a number
+    Real value;
+    /// The index of a variable in the input array
+    unsigned int var;
+    /// The operands
+    std::vector<Node *> args;
+  };
+
+  ///@{ Recursive descent parser, one method per precedence level of the fparser syntax
+  Node * parseOr();
+  Node * parseAnd();
+  Node * parseComparison();
+  Node * parseAdditive();
+  Node * parseMultiplicative();
+  Node * parseUnary();
+  Node * parsePower();
+  Node * parsePrimary();
+  ///@}
+
+  /// Skip white space and tell if the expression continues with str (which is then consumed)
+  bool accept(const std::string & str);
+
+  /// Build a node with up to two operands
+  Node * makeNode(const std::string & op, Node * a = NULL, Node * b = NULL);
+
+  /// Throw a parse error (caught in compile())
+  void parseError(const std::string & msg);
+
+  /// Translate a tree into a C++ expression templated on the number type T
+  void generate(const Node * node, std::ostream & code) const;
+
+  /// Find, and create if needed, the directory the libraries are cached in
+  bool cacheDirectory(std::string & cache_dir);
+
+  /// Compile the generated code into a library in the cache
+  bool build(const std::string & code, const std::string & cxx, const std::string & cache_dir,
+             const std::string & hash, const std::string & library);
+
+  /// Load a compiled library and look up the entry points
+  bool load(const std::string & library);
+
+  /// The function in the fparser syntax
+  std::string _expression;
+
+  /// The names of all of the inputs (x, y, z, t and the variables)
+  std::vector<std::string> _inputs;
+
+  /// Current position of the parser in _expression
+  std::string::size_type _pos;
+
+  /// All of the nodes of the tree (they are deleted along with this object)
+  std::vector<Node *> _nodes;
+
+  /// The reason compile() failed
+  std::string _error;
+
+  /// Handle returned by dlopen()
+  void * _handle;
+
+  /// Entry points of the compiled code
+  Real (*_value_fn)(const Real *);
+  void (*_derivatives_fn)(const Real *, Real *);
+};
+
+#endif // PARSEDFUNCTIONJIT_H
@@ -0,0 +1,91 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef RANGEALLOCATOR_H
+#define RANGEALLOCATOR_H
+
+#include <vector>
+#include <map>
+
+/**
+ * Hands out contiguous ranges of slots inside a list of fixed size blocks.  The allocator only does the
+ * bookkeeping, the caller owns the storage of the blocks.
+ *
+ * Blocks grow geometrically and are never resized, so a range stays valid until it is released.  Released
+ * ranges are handed out again (best fit, the rest of a larger range stays free) before a new block is
+ * started.  Neighboring free ranges are not merged: the callers ask for a few distinct sizes (the number of
+ * quadrature points of an element or side), so a released range is usually reused at its own size.
+ */
+class RangeAllocator
+{
+public:
+  /**
+   * A range of slots inside one block
+   */
+  struct Range
+  {
+    unsigned int _block;
+    unsigned int _offset;
+    unsigned int _size;
+  };
+
+  /**
+   * @param min_block_capacity The smallest number of slots a new block is sized for
+   */
+  RangeAllocator(unsigned int min_block_capacity);
+
+  /**
+   * Find room for a number of slots
+   * @param size The number of slots
+   * @param new_block Set to true if a new block was started, the caller has to create
+   *        storage for blockCapacity(range._block) slots before using the range
+   */
+  Range allocate(unsigned int size, bool & new_block);
+
+  /**
+   * Give a range back so it can be handed out again
+   */
+  void release(const Range & range);
+
+  /**
+   * Forget all blocks and ranges
+   */
+  void clear();
+
+  unsigned int nBlocks() const { return _block_capacity.size(); }
+  unsigned int blockCapacity(unsigned int block) const { return _block_capacity[block]; }
+
+  /**
+   * @return The number of slots currently handed out
+   */
+  unsigned int allocated() const { return _n_allocated; }
+
+protected:
+  /// The smallest number of slots a new block is sized for
+  unsigned int _min_block_capacity;
+
+  /// Number of slots each block can hold
+  std::vector<unsigned int> _block_capacity;
+
+  /// Number of slots used at the end of the last block (earlier blocks are full or their tails are free)
+  unsigned int _last_block_used;
+
+  /// Released ranges keyed by their size: (block, offset)
+  std::multimap<unsigned int, std::pair<unsigned int, unsigned int> > _free;
+
+  /// Number of slots currently handed out
+  unsigned int _n_allocated;
+};
+
+#endif /* RANGEALLOCATOR_H */
@@ -29,6 +29,8 @@ public:
 
     virtual ~WaterSteamEOS();
 
+    virtual void initialSetup();
+
     virtual void initialize(){}
 
     virtual void execute(){}
@@ -49,6 +51,78 @@ public:
     Real waterAndSteamEquationOfStatePropertiesPH (Real enth_in, Real press_in, Real temp_in, Real& phase, Real& temp_out, Real& temp_sat, Real& sat_fraction_out, Real& dens_out, Real& dens_water_out, Real& dens_steam_out, Real& enth_water_out, Real& enth_steam_out, Real& visc_water_out, Real& visc_steam_out, Real& del_press, Real& del_enth) const;
 
     Real waterAndSteamEquationOfStatePropertiesWithDerivativesPH (Real enth_in, Real press_in, Real temp_in, Real& temp_out, Real& sat_fraction_out, Real& dens_out, Real& dens_water_out, Real& dens_steam_out, Real& enth_water_out, Real& enth_steam_out, Real& visc_water_out, Real& visc_steam_out, Real& d_enth_water_d_press, Real& d_enth_steam_d_press, Real& d_dens_d_press, Real& d_temp_d_press, Real& d_enth_water_d_enth, Real& d_enth_steam_d_enth, Real& d_dens_d_enth, Real& d_temp_d_enth, Real& d_sat_fraction_d_enth) const;
+
+protected:
+    /// Properties stored at every node of the (pressure, enthalpy) table
+    enum TableProperty
+    {
+      TEMP = 0,
+      TEMP_SAT,
+      SAT_FRACTION,
+      DENS,
+      DENS_WATER,
+      DENS_STEAM,
+      ENTH_WATER,
+      ENTH_STEAM,
+      VISC_WATER,
+      VISC_STEAM,
+      N_TABLE_PROPS
+    };
+
+    /**
+     * Bicubic Hermite interpolation of the tabulated properties at (press_in, enth_in).
+     * d_dp and d_dh may be NULL if the derivatives are not needed.
+     * @return false if the point lies outside the table, or in a cell that has to be evaluated directly
+     */
+    bool interpolatePH (Real enth_in, Real press_in, Real& phase, Real * value, Real * d_dp, Real * d_dh) const;
+
+    /// Evaluates IAPWS-IF97 directly at (press_in, enth_in) and packs the tabulated properties into value
+    void directPropertiesPH (Real enth_in, Real press_in, Real& phase, Real * value) const;
+
+    /// Evaluates IAPWS-IF97 at every node and decides which cells may be interpolated
+    void buildTable();
+
+    /// Loads the table from file_name, returning false if it is missing or was built with different parameters
+    bool readTable(const std::string & file_name);
+
+    void writeTable(const std::string & file_name) const;
+
+    /// The largest magnitude of every tabulated property at the nodes, which scales the interpolation errors
+    void tableScale(Real * scale) const;
+
+    /// Times n evaluations of the direct and the tabulated path and prints the evaluation rates, it is an
+    /// error if the tabulated properties differ from the formulas by more than the table tolerance
+    void benchmark(unsigned int n);
+
+    /// Set once the table is ready; the direct formulas are used until then
+    bool _use_table;
+
+    Real _p_min, _p_max, _h_min, _h_max;
+    unsigned int _n_p, _n_h;
+    Real _dp, _dh;
+    Real _table_tolerance;
+
+    /// The file the table was read from, empty if it was built
+    std::string _table_read_from;
+
+    /// The tabulated properties
+    struct TableData
+    {
+      /// Phase at every node, [j*_n_p + i] for pressure index i and enthalpy index j
+      std::vector<Real> _node_phase;
+
+      /// Value, d/di, d/dj and d^2/di/dj of every property at every node, [((j*_n_p + i)*N_TABLE_PROPS + prop)*4 + k]
+      std::vector<Real> _table;
+
+      /// Whether each cell may be interpolated, [j*(_n_p-1) + i]
+      std::vector<unsigned char> _cell_interpolated;
+    };
+
+    /// The table built, read or received from the first processor by this object; empty in the thread copies
+    TableData _own_table;
+
+    /// The table used for interpolation, which the thread copies share with the first one
+    const TableData * _table_data;
 };
 
 #endif /* WATERSTEAMEOS_H */
@@ -0,0 +1,39 @@
+# Builds a WaterSteamEOS table and compares evaluations per second, and the
+# largest difference from IAPWS-IF97, between the table and the direct formulas.
+# The tests file runs it again with the default table size as a heavy benchmark.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[UserObjects]
+  [./eos]
+    type = WaterSteamEOS
+    use_table = true
+    table_size = '41 41'
+    table_tolerance = 1e-3
+    benchmark_evaluations = 10000
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  console = true
+[]
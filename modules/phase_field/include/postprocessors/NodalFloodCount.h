@@ -21,9 +21,8 @@
 #include "ZeroInterface.h"
 #include "InfixIterator.h"
 
-#include <list>
 #include <vector>
-#include <set>
+#include <map>
 #include <iterator>
 
 #include "libmesh/periodic_boundaries.h"
@@ -67,18 +66,6 @@ public:
   virtual std::vector<std::vector<std::pair<unsigned int, unsigned int> > > getElementalValues(unsigned int /*elem_id*/) const;
 
 protected:
-  class BubbleData
-  {
-  public:
-    BubbleData(std::set<unsigned int> & nodes, unsigned int var_idx) :
-        _nodes(nodes),
-        _var_idx(var_idx)
-      {}
-
-    std::set<unsigned int> _nodes;
-    unsigned int _var_idx;
-  };
-
   /**
    * This method is used to populate any of the data structures used for storing field data (nodal or elemental).
    * It is called at the end of finalize and can make use of any of the data structures created during
@@ -87,36 +74,37 @@ protected:
   virtual void updateFieldInfo();
 
   /**
-   * This method will "mark" all nodes on neighboring elements that
-   * are above the supplied threshold
+   * This method builds the local node numbering, the seed order and the compressed nodal adjacency
+   * used by the flood.  Only nodes of local elements are included.
    */
-  void flood(const Node *node, int current_idx, unsigned int live_region);
+  void buildAdjacency();
 
   /**
-   * These routines packs/unpack the _bubble_map data into a structure suitable for parallel
-   * communication operations. See the comments in these routines for the exact
-   * data structure layout.
+   * This method "marks" all connected nodes above the threshold for a single variable.  It is iterative
+   * so large regions cannot overflow the stack, and it only touches data belonging to var_num so the
+   * variables can be flooded on separate threads.
    */
-  void pack(std::vector<unsigned int> &, bool merge_periodic_info=true) const;
-  void unpack(const std::vector<unsigned int> &);
+  void flood(unsigned int var_num);
 
   /**
-   * This routine merges the data in _bubble_sets from separate threads/processes to resolve
-   * any bubbles that were counted as unique by multiple processors.
+   * This routine combines the regions found for each variable into the regions of each map, numbered in
+   * the order their seeds were found.
    */
-  void mergeSets();
+  void collectRegions();
 
   /**
-   * This routine returns whether or not a nodal value is valid on a particular processor
-   * (i.e. includes values owned by this processor and ghost nodes)
+   * These routines pack the regions touching processor or periodic boundaries and merge packed regions
+   * that share a boundary node.  See the comments in these routines for the exact data structure layout.
    */
-  bool isNodeValueValid(unsigned int node_id) const;
+  void packBoundaryRegions(std::vector<unsigned int> & packed_data) const;
+  static void mergePackedRegions(std::vector<unsigned int> & packed_data);
 
   /**
-   * This routine adds the periodic node information to our data structure prior to packing the data
-   * this makes those periodic neighbors appear much like ghosted nodes in a multiprocessor setting
+   * This routine merges the regions from separate processes and across periodic boundaries to resolve
+   * any bubbles that were counted as unique more than once.  Only boundary regions are communicated,
+   * and they are merged up a binary tree of processors.
    */
-  unsigned int appendPeriodicNeighborNodes(std::set<unsigned int> & data) const;
+  void mergeSets();
 
   /**
    * This routine updates the _region_offsets variable which is useful for quickly determining
@@ -125,7 +113,7 @@ protected:
   void updateRegionOffsets();
 
   /**
-   * This routine uses the bubble_sets data structure to calculate the volume of each stored bubble.
+   * This routine uses the nodal bubble maps to calculate the volume of each stored bubble.
    */
   void calculateBubbleVolumes();
 
@@ -136,26 +124,6 @@ protected:
   template<class T>
   void writeCSVFile(const std::string file_name, const std::vector<T> data);
 
-  /**
-   * This method detects whether two sets intersect without building a result set.  It exits as soon as
-   * any intersection is detected.
-   */
-  template<class InputIterator>
-  inline bool setsIntersect(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2) const
-    {
-      while (first1 != last1 && first2 != last2)
-      {
-        if (*first1 == *first2)
-          return true;
-
-        if (*first1 < *first2)
-          ++first1;
-        else if (*first1 > *first2)
-          ++first2;
-      }
-      return false;
-    }
-
   // Attempt to make a lower bound computation of memory consumed by this object
   virtual unsigned long calculateUsage() const;
 
@@ -203,45 +171,60 @@ protected:
   /// Convienence variable holding the size of all the datastructures size by the number of maps
   const unsigned int _maps_size;
 
-  /**
-   * This variable keeps track of which nodes have been visited during execution.  We don't use the _bubble_map
-   * for this since we don't want to explicitly store data for all the unmarked nodes in a serialized datastructures.
-   * This keeps our overhead down since this variable never needs to be communicated.
-   */
-  std::vector<std::map<unsigned int, bool> > _nodes_visited;
+  /// The nodes of the local elements, indexed by the local numbering used by all of the flat arrays below
+  std::vector<const Node *> _local_nodes;
+
+  /// The local index of every node id, or invalid_uint for nodes not touching a local element
+  std::vector<unsigned int> _node_to_local;
+
+  /// Local indices of the element vertices in the order they are tried as the start of a new region
+  std::vector<unsigned int> _seeds;
+
+  /// Neighbors of local node i are _adjacency[_adjacency_offsets[i]] to _adjacency[_adjacency_offsets[i+1]-1]
+  std::vector<unsigned int> _adjacency_offsets;
+  std::vector<unsigned int> _adjacency;
+
+  /// Whether each local node is shared with another processor or sits on a periodic boundary
+  std::vector<unsigned char> _boundary_nodes;
+
+  /// The nodal values of each coupled variable at the local nodes
+  std::vector<std::vector<Real> > _nodal_values;
+
+  /// This variable keeps track of which local nodes have been visited by the flood of each variable.
+  std::vector<std::vector<unsigned char> > _nodes_visited;
+
+  /// The region (starting at 1, 0 for none) each local node was flooded into for each variable
+  std::vector<std::vector<unsigned int> > _var_regions;
+
+  /// The position in the seed order at which each region of each variable was started
+  std::vector<std::vector<unsigned int> > _region_seeds;
 
   /**
-   * The bubble maps contain the raw flooded node information and eventually the unique grain numbers.  We have a vector
-   * of them so we can create one per variable if that level of detail is desired.
+   * The bubble maps contain the bubble number of each local node (0 for none), first local and then unique
+   * across processors.  We have a vector of them so we can create one per variable if that level of detail is desired.
    */
-  std::vector<std::map<unsigned int, int> > _bubble_maps;
+  std::vector<std::vector<unsigned int> > _bubble_maps;
 
   /**
-   * This map keeps track of which variables own which nodes.  We need a vector of them for multimap mode where
+   * This map keeps track of which variables own which local nodes.  We need a vector of them for multimap mode where
    * multiple variables can own a single mode.  Note: This map is only populated when "show_var_coloring" is set
    * to true.
    */
-  std::vector<std::map<unsigned int, int> > _var_index_maps;
+  std::vector<std::vector<unsigned int> > _var_index_maps;
 
-  /// The data structure used to marshall the data between processes and/or threads
+  /// The data structure used to marshall the boundary regions between processes
   std::vector<unsigned int> _packed_data;
 
   /// The data structure used to find neighboring elements give a node ID
   std::vector< std::vector< const Elem * > > _nodes_to_elem_map;
 
-  /// This data structure is used to keep track of which bubbles are owned by which variables (index).
-  std::vector<unsigned int> _region_to_var_idx;
+  /// The variable owning each local region of each map
+  std::vector<std::vector<unsigned int> > _region_to_var_idx;
 
   /// This data structure holds the offset value for unique bubble ids (updated inside of finalize)
   std::vector<unsigned int> _region_offsets;
 
-  /**
-   * The data structure used to join partial bubbles between processes and/or threads.  We may have a list of BubbleData
-   * per variable in multi-map mode
-   */
-  std::vector<std::list<BubbleData> > _bubble_sets;
-
-  /// The scalar counters used during the marking stage of the flood algorithm. Up to one per variable
+  /// The number of regions in each map, local after execute and global after finalize
   std::vector<unsigned int> _region_counts;
 
   /// A pointer to the periodic boundary constraints object
@@ -271,6 +254,8 @@ protected:
 
   // Dummy value for unimplemented method
   static const std::vector<std::pair<unsigned int, unsigned int> > _empty;
+
+  friend class NodalFloodThread;
 };
 
 template<typename T>
@@ -0,0 +1,82 @@
+# Two variables whose bubbles are cut by the periodic boundaries, counted on separate maps.
+# gr0 has one bubble split over the four corners and one in the middle, gr1 has a stripe split
+# by the left and right boundaries and one in the middle.  Counting the pieces on either side of
+# the boundaries as separate bubbles would give 8 instead of 4.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmax = 100
+  ymax = 100
+  elem_type = QUAD4
+[]
+
+[Functions]
+  [./gr0_ic]
+    type = ParsedFunction
+    value = 'if(min(x,100-x)^2+min(y,100-y)^2<420, 1, 0) + if((x-50)^2+(y-50)^2<240, 1, 0)'
+  [../]
+  [./gr1_ic]
+    type = ParsedFunction
+    value = 'if(min(x,100-x)<12 & y>32 & y<68, 1, 0) + if((x-50)^2+(y-50)^2<240, 1, 0)'
+  [../]
+[]
+
+[Variables]
+  [./gr0]
+    [./InitialCondition]
+      type = FunctionIC
+      function = gr0_ic
+    [../]
+  [../]
+  [./gr1]
+    [./InitialCondition]
+      type = FunctionIC
+      function = gr1_ic
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./ie_gr0]
+    type = TimeDerivative
+    variable = gr0
+  [../]
+  [./ie_gr1]
+    type = TimeDerivative
+    variable = gr1
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./bubbles]
+    type = NodalFloodCount
+    variable = 'gr0 gr1'
+    use_single_map = false
+    execute_on = timestep
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 1
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
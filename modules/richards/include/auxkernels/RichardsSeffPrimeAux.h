@@ -30,6 +30,9 @@ protected:
 
   std::vector<unsigned int> _pressure_vars;
   std::vector<VariableValue *> _pressure_vals;
+
+  // scratch space for d(seff)/dp, sized once in the constructor
+  std::vector<Real> _mat_seff;
 };
 
 #endif // RICHARDSSEFFPRIMEAUX_H
@@ -31,6 +31,9 @@ protected:
 
   std::vector<unsigned int> _pressure_vars;
   std::vector<VariableValue *> _pressure_vals;
+
+  // scratch space for d^2(seff)/dp^2, sized once in the constructor
+  std::vector<Real> _mat_seff;
 };
 
 #endif // RICHARDSSEFFPRIMEPRIMEAUX_H
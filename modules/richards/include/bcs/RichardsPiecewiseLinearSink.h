@@ -38,10 +38,11 @@ protected:
 
   const RichardsPorepressureNames & _pp_name_UO;
   unsigned int _pvar;
+  unsigned int _num_p;
 
   MaterialProperty<std::vector<Real> > &_viscosity;
   MaterialProperty<RealTensorValue> & _permeability;
-  MaterialProperty<std::vector<std::vector<Real> > > &_dseff;
+  MaterialProperty<std::vector<Real> > &_dseff;
   MaterialProperty<std::vector<Real> > &_rel_perm;
   MaterialProperty<std::vector<Real> > &_drel_perm;
   MaterialProperty<std::vector<Real> > &_density;
@@ -32,6 +32,7 @@ protected:
 
   const RichardsPorepressureNames & _pp_name_UO;
   unsigned int _pvar;
+  unsigned int _num_p;
 
   Real _character;
   Real _p_bot;
@@ -44,7 +45,7 @@ protected:
 
   MaterialProperty<RealTensorValue> & _permeability;
 
-  MaterialProperty<std::vector<std::vector<Real> > > &_dseff;
+  MaterialProperty<std::vector<Real> > &_dseff;
 
   MaterialProperty<std::vector<Real> > &_rel_perm;
   MaterialProperty<std::vector<Real> > &_drel_perm;
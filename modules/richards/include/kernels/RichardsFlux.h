@@ -32,14 +32,15 @@ protected:
 
   const RichardsPorepressureNames & _pp_name_UO;
   unsigned int _pvar;
+  unsigned int _num_p;
 
   MaterialProperty<std::vector<Real> > &_viscosity;
   MaterialProperty<RealVectorValue> &_gravity;
   MaterialProperty<RealTensorValue> & _permeability;
 
   MaterialProperty<std::vector<Real> > &_seff;
-  MaterialProperty<std::vector<std::vector<Real> > > &_dseff;
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > &_d2seff;
+  MaterialProperty<std::vector<Real> > &_dseff;
+  MaterialProperty<std::vector<Real> > &_d2seff;
 
   MaterialProperty<std::vector<Real> > &_rel_perm;
   MaterialProperty<std::vector<Real> > &_drel_perm;
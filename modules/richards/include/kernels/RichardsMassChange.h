@@ -31,6 +31,7 @@ protected:
 
   const RichardsPorepressureNames & _pp_name_UO;
   unsigned int _pvar;
+  unsigned int _num_p;
 
   bool _use_supg;
 
@@ -40,8 +41,8 @@ protected:
   MaterialProperty<std::vector<Real> > &_sat_old;
 
   MaterialProperty<std::vector<Real> > &_sat;
-  MaterialProperty<std::vector<std::vector<Real> > > &_dsat;
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > &_d2sat;
+  MaterialProperty<std::vector<Real> > &_dsat;
+  MaterialProperty<std::vector<Real> > &_d2sat;
 
   MaterialProperty<std::vector<Real> > &_density_old;
 
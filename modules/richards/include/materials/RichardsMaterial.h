@@ -63,14 +63,14 @@ private:
   MaterialProperty<std::vector<Real> > & _seff_old; // old effective saturation
 
   MaterialProperty<std::vector<Real> > & _seff; // effective saturation
-  MaterialProperty<std::vector<std::vector<Real> > > & _dseff; // d(seff)/dp
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _d2seff; // d^2(seff)/dp^2
+  MaterialProperty<std::vector<Real> > & _dseff; // d(seff_i)/dp_j stored at [i*_num_p + j]
+  MaterialProperty<std::vector<Real> > & _d2seff; // d^2(seff_i)/dp_j/dp_k stored at [(i*_num_p + j)*_num_p + k]
 
   MaterialProperty<std::vector<Real> >& _sat_old; // old saturation
 
   MaterialProperty<std::vector<Real> >& _sat; // saturation
-  MaterialProperty<std::vector<std::vector<Real> > >& _dsat; // d(saturation)/dp
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > >& _d2sat; // d^2(saturation)/dp^2
+  MaterialProperty<std::vector<Real> >& _dsat; // d(saturation)/dp, same layout as _dseff
+  MaterialProperty<std::vector<Real> >& _d2sat; // d^2(saturation)/dp^2, same layout as _d2seff
 
   MaterialProperty<std::vector<Real> > & _rel_perm; // relative permeability
   MaterialProperty<std::vector<Real> > & _drel_perm; // d(relperm)/dSeff
@@ -92,6 +92,10 @@ private:
   std::vector<const RichardsDensity *> _material_density_UO;
   std::vector<const RichardsSUPG *> _material_SUPG_UO;
 
+  // scratch space the seff user objects write their derivatives into
+  std::vector<Real> _dseff_val;
+  std::vector<Real> _d2seff_val;
+
 
 
 };
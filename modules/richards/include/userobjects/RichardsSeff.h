@@ -26,10 +26,13 @@ class RichardsSeff : public GeneralUserObject
   void finalize();
 
   // These functions must be over-ridden in the derived class
-  // to provide the actual values of seff and its derivatives
-  virtual Real seff(std::vector<VariableValue *> p, unsigned int qp) const = 0;
-  virtual std::vector<Real> dseff(std::vector<VariableValue *> p, unsigned int qp) const = 0;
-  virtual std::vector<std::vector<Real> > d2seff(std::vector<VariableValue *> p, unsigned int qp) const = 0;
+  // to provide the actual values of seff and its derivatives.
+  // The derivatives are written into result, which the caller must have
+  // sized to p.size() for dseff, and p.size()*p.size() for d2seff, where
+  // result[i*p.size() + j] = d^2(seff)/dp_i/dp_j
+  virtual Real seff(const std::vector<VariableValue *> & p, unsigned int qp) const = 0;
+  virtual void dseff(const std::vector<VariableValue *> & p, unsigned int qp, std::vector<Real> & result) const = 0;
+  virtual void d2seff(const std::vector<VariableValue *> & p, unsigned int qp, std::vector<Real> & result) const = 0;
 
 };
 
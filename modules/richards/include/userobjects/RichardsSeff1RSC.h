@@ -24,9 +24,9 @@ class RichardsSeff1RSC : public RichardsSeff
  public:
   RichardsSeff1RSC(const std::string & name, InputParameters parameters);
 
-  Real seff(std::vector<VariableValue *> p, unsigned int qp) const;
-  std::vector<Real> dseff(std::vector<VariableValue *> p, unsigned int qp) const;
-  std::vector<std::vector<Real> > d2seff(std::vector<VariableValue *> p, unsigned int qp) const;
+  Real seff(const std::vector<VariableValue *> & p, unsigned int qp) const;
+  void dseff(const std::vector<VariableValue *> & p, unsigned int qp, std::vector<Real> & result) const;
+  void d2seff(const std::vector<VariableValue *> & p, unsigned int qp, std::vector<Real> & result) const;
 
  protected:
 
@@ -16,13 +16,65 @@ public:
   FiniteStrainCrystalPlasticity(const std:: string & name, InputParameters parameters);
 
 protected:
+  /// The largest number of slip systems, which sizes the fixed size arrays of the constitutive update
+  static const unsigned int MAX_SLIP_SYSTEMS = 48;
+
+  /// The number of quadrature points whose constitutive update runs together
+  static const unsigned int BATCH_SIZE = 8;
+
+  /**
+   * The state of the constitutive update of a batch of quadrature points.  The slip system arrays
+   * have the quadrature points innermost so the loops over the quadrature points can be vectorized.
+   */
+  struct ConstitutiveBatch
+  {
+    /// The first quadrature point and the number of quadrature points in the batch
+    unsigned int qp_begin;
+    unsigned int size;
+
+    /// Which quadrature points are still iterating
+    bool active[BATCH_SIZE];
+
+    /// The Schmid tensors, mo_i no_j, of the slip systems
+    Real s0[MAX_SLIP_SYSTEMS][3][3];
+
+    RankTwoTensor pk2[BATCH_SIZE];
+    RankTwoTensor sig[BATCH_SIZE];
+    RankTwoTensor fp_old_inv[BATCH_SIZE];
+    RankTwoTensor fp_inv[BATCH_SIZE];
+    RankTwoTensor resid[BATCH_SIZE];
+    RankFourTensor jac[BATCH_SIZE];
+
+    Real gss[MAX_SLIP_SYSTEMS][BATCH_SIZE];
+    Real tau[MAX_SLIP_SYSTEMS][BATCH_SIZE];
+    Real slip_incr[MAX_SLIP_SYSTEMS][BATCH_SIZE];
+    Real dslipdtau[MAX_SLIP_SYSTEMS][BATCH_SIZE];
+  };
+
+  /**
+   * Runs the constitutive update for all of the quadrature points of the element in batches,
+   * after computing the strain and the elasticity tensors.
+   */
+  virtual void computeProperties();
+
   virtual void computeQpStress();
   virtual void computeQpElasticityTensor();
   virtual void initQpStatefulProperties();
-  virtual void calc_resid_jacob(RankTwoTensor*,RankTwoTensor*,RankTwoTensor*,RankTwoTensor*,Real*,Real*,
-                                RankTwoTensor*,RankFourTensor*);
-  virtual void get_slip_incr(Real*,Real*,Real*);
-  virtual void update_gss(Real*);
+
+  /**
+   * Integrates the stress and the slip system hardness of the quadrature points qp_begin to qp_end - 1
+   * (at most BATCH_SIZE of them) together.  Each quadrature point iterates until it converges.
+   */
+  void update_stress(unsigned int qp_begin, unsigned int qp_end);
+
+  /// Computes the residual and Jacobian of the stress update at the active quadrature points of the batch
+  virtual void calc_resid_jacob(ConstitutiveBatch & batch);
+  virtual void get_slip_incr(ConstitutiveBatch & batch);
+  /// Updates the slip system hardness at the active quadrature points of the batch
+  virtual void update_gss(ConstitutiveBatch & batch);
+
+  /// Stops with an error if the slip increment at an active quadrature point exceeds the tolerance
+  void check_slip_incr(const ConstitutiveBatch & batch);
 
   virtual void get_slip_sys();
   virtual void get_euler_ang();
@@ -72,6 +124,13 @@ protected:
   MaterialProperty<RankTwoTensor> & _crysrot;
   MaterialProperty<RankTwoTensor> & _crysrot_old;
 
+  /// The number of stress iterations, summed over the hardness iterations, at each quadrature point
+  MaterialProperty<Real> & _constitutive_iterations;
+
+  /// The wall time in seconds spent on the constitutive update of the element, stored at each of its
+  /// quadrature points (NULL unless output_constitutive_time is set)
+  MaterialProperty<Real> * _constitutive_time;
+
 
 
 private:
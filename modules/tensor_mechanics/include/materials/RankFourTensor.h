@@ -18,6 +18,8 @@
 #include "libmesh/vector_value.h"
 #include "RankTwoTensor.h"
 
+class SymmRankFourTensor;
+
 class RankFourTensor
 {
 public:
@@ -32,6 +34,11 @@ public:
    */
   RankFourTensor(const RankFourTensor &a);
 
+  /**
+   * Constructor from the Mandel storage of a tensor with the minor symmetries
+   */
+  explicit RankFourTensor(const SymmRankFourTensor &a);
+
   ~RankFourTensor() {}
 
   /**
@@ -0,0 +1,123 @@
+/**
+ * SymmRankFourTensor is designed to handle fourth order tensors with the minor symmetries
+ * C_ijkl = C_jikl = C_ijlk, e.g. elasticity tensors or the derivative of a symmetric stress with
+ * respect to a symmetric strain.
+ *
+ * SymmRankFourTensor holds the 36 entries of the 6x6 matrix of the tensor in Mandel notation: the
+ * rows and columns are ordered 11, 22, 33, 23, 13, 12 and the shear rows and columns are scaled by
+ * sqrt(2).  In this form the double contraction of two tensors is the matrix product, the inverse on
+ * symmetric tensors is the matrix inverse and a rotation is Q C Q^T with an orthogonal 6x6 Q, so every
+ * operation works on the 36 entries instead of the 81 of a RankFourTensor.  Major symmetry is not
+ * assumed.  The entries are accessed by index, with i, j, k, and l equal to 0, 1, 2
+ *
+ */
+
+#ifndef SYMMRANKFOURTENSOR_H
+#define SYMMRANKFOURTENSOR_H
+
+// Any requisite includes here
+#include "libmesh/tensor_value.h"
+#include <vector>
+#include "libmesh/libmesh.h"
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
+class SymmRankFourTensor
+{
+public:
+
+  /**
+   * Default constructor; fills to zero
+   */
+  SymmRankFourTensor();
+
+  /**
+   * Constructor from a RankFourTensor, which keeps its minor symmetric part.  The conversion
+   * is lossless for tensors with the minor symmetries.
+   */
+  explicit SymmRankFourTensor(const RankFourTensor &a);
+
+  ~SymmRankFourTensor() {}
+
+  /**
+   * Gets the value for the index specified.  Takes index = 0,1,2
+   */
+  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+
+  /**
+   * Gets the entry of the Mandel matrix.  Takes index = 0,...,5
+   */
+  Real & mandel(unsigned int I, unsigned int J) { return _vals[I*N + J]; }
+  Real mandel(unsigned int I, unsigned int J) const { return _vals[I*N + J]; }
+
+  /**
+   * Zeros out the tensor.
+   */
+  void zero();
+
+  RankTwoTensor operator*(const RankTwoTensor &a) const;
+
+  SymmRankFourTensor operator*(const Real &a) const;
+
+  SymmRankFourTensor & operator*=(const Real &a);
+
+  SymmRankFourTensor & operator+=(const SymmRankFourTensor &a);
+
+  SymmRankFourTensor operator+(const SymmRankFourTensor &a) const;
+
+  SymmRankFourTensor & operator-=(const SymmRankFourTensor &a);
+
+  SymmRankFourTensor operator-(const SymmRankFourTensor &a) const;
+
+  SymmRankFourTensor operator - () const;
+
+  /**
+   * Double contraction C_ijpq a_pqkl
+   */
+  SymmRankFourTensor operator*(const SymmRankFourTensor &a) const;
+
+  /**
+   * Inverse on the space of symmetric tensors, same as RankFourTensor::invSymm
+   */
+  SymmRankFourTensor invSymm() const;
+
+  /**
+   * Rotates the tensor data given the rotation tensor, C_ijkl = R_im R_jn R_ko R_lp C_mnop
+   */
+  void rotate(const RealTensorValue &R);
+
+  SymmRankFourTensor transposeMajor() const;
+
+  /**
+   * Fills the tensor from 21 (all=true) or 9 (all=false) inputs, see RankFourTensor::fillFromInputVector
+   */
+  void fillFromInputVector(const std::vector<Real> input, bool all);
+
+  /**
+   * Print the tensor
+   */
+  void print() const;
+
+  /**
+   * Inverts the row major 6x6 matrix mat in place by Gauss-Jordan elimination with partial pivoting.
+   * Returns false, leaving mat undefined, if the matrix is singular.
+   */
+  static bool invert6x6(Real *mat);
+
+protected:
+
+  /**
+   * Contains the entries of the row major 6x6 Mandel matrix.
+   */
+  static const unsigned int N = 6;
+
+  Real _vals[N*N];
+
+  /// The row or column of the Mandel matrix for each pair of indices
+  static const unsigned int _index[3][3];
+
+  /// The factor scaling the rows and columns of the Mandel matrix, 1 for the normal and sqrt(2) for the shear components
+  static const Real _factor[N];
+};
+
+#endif //SYMMRANKFOURTENSOR_H
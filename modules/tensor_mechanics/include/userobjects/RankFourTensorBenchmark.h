@@ -0,0 +1,50 @@
+#ifndef RANKFOURTENSORBENCHMARK_H
+#define RANKFOURTENSORBENCHMARK_H
+
+#include "GeneralUserObject.h"
+#include "RankFourTensor.h"
+#include "SymmRankFourTensor.h"
+
+class RankFourTensorBenchmark;
+
+/**
+ * RankFourTensorBenchmark times the RankFourTensor operations used by the finite strain materials
+ * against the same operations on SymmRankFourTensor, and checks that both give the same results.
+ */
+
+template<>
+InputParameters validParams<RankFourTensorBenchmark>();
+
+class RankFourTensorBenchmark : public GeneralUserObject
+{
+public:
+  RankFourTensorBenchmark(const std::string & name, InputParameters parameters);
+
+  virtual ~RankFourTensorBenchmark() {}
+
+  virtual void initialSetup();
+
+  virtual void initialize() {}
+  virtual void execute() {}
+  virtual void finalize() {}
+
+protected:
+  /// Prints the operation rates of both tensor types and stops if their results differ
+  void report(const std::string & operation, Real full_time, Real symm_time, Real difference) const;
+
+  /// The largest difference between the entries of a and b, relative to the largest entry of a
+  static Real difference(const RankFourTensor & a, const SymmRankFourTensor & b);
+  static Real difference(const RankTwoTensor & a, const RankTwoTensor & b);
+
+  const unsigned int _operations;
+  const Real _tolerance;
+
+  /// The tensors operated on, cycled through during the timing
+  std::vector<RankFourTensor> _full;
+  std::vector<SymmRankFourTensor> _symm;
+  std::vector<RankTwoTensor> _strains;
+
+  RealTensorValue _rotation;
+};
+
+#endif //RANKFOURTENSORBENCHMARK_H
@@ -0,0 +1,36 @@
+# Times the RankFourTensor operations used by the finite strain materials against
+# SymmRankFourTensor and checks that both give the same results.
+# The tests file runs it again with more operations as a heavy benchmark.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[UserObjects]
+  [./benchmark]
+    type = RankFourTensorBenchmark
+    operations = 1000
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  console = true
+[]
@@ -0,0 +1,52 @@
+# Times NearestNodeLocator::findNodes() between two large faces of a thin
+# slab.  The default mesh has ~1e5 nodes on each face, the tests file
+# runs it again with ~1e6.  Look for "NearestNodeLocator::findNodes()"
+# in the performance log.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 316
+  nz = 316
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./distance]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxBCs]
+  [./distance]
+    type = NearestNodeDistanceAux
+    variable = distance
+    boundary = left
+    paired_boundary = right
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
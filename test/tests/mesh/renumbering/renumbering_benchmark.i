@@ -0,0 +1,72 @@
+# Mesh renumbering benchmark.  The "compute_residual()" and "compute_jacobian()"
+# entries in the perf log give the residual and Jacobian times for each
+# renumbering in the tests file.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 50
+  ny = 50
+  nz = 50
+  renumbering = none
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./force_v]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 0
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'jacobi'
+  l_max_its = 10
+  nl_max_its = 2
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
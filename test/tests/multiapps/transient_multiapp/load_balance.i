@@ -0,0 +1,79 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 0.2
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  output_initial = true
+  exodus = true
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
+
+[Postprocessors]
+  [./sub_app0_solve_time]
+    type = MultiAppSolveTime
+    multi_app = sub_app
+    app = 0
+  [../]
+[]
+
+[MultiApps]
+  [./sub_app]
+    positions = '0 0 0  0.5 0.5 0  0.6 0.6 0  0.7 0.7 0'
+    type = TransientMultiApp
+    # The first App solves the same problem as the others but takes much longer, so the Apps
+    # sharing its processor are moved away
+    input_files = 'load_balance_sub.i dt_from_master_sub.i dt_from_master_sub.i dt_from_master_sub.i'
+    app_type = MooseTestApp
+    load_balance = true
+    load_balance_tolerance = 0.1
+  [../]
+[]
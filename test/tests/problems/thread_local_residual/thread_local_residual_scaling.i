@@ -0,0 +1,73 @@
+# Residual assembly scaling benchmark.  The "ComputeResidualThread" entry in the
+# perf log gives the residual time for each thread count in the tests file.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 60
+  ny = 60
+  nz = 60
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./force_v]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 0
+  [../]
+[]
+
+[Problem]
+  thread_local_residual = true
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'jacobi'
+  l_max_its = 10
+  nl_max_its = 1
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
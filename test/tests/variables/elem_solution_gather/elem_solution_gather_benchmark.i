@@ -0,0 +1,290 @@
+# Element reinit benchmark with many coupled variables.  The DOF values of all of
+# the variables on an element are gathered once per solution vector, compare the
+# "compute_residual()" and "compute_jacobian()" entries of the perf log.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 30
+  ny = 30
+  nz = 30
+[]
+
+[Variables]
+  [./u0]
+  [../]
+  [./u1]
+  [../]
+  [./u2]
+  [../]
+  [./u3]
+  [../]
+  [./u4]
+  [../]
+  [./u5]
+  [../]
+  [./u6]
+  [../]
+  [./u7]
+  [../]
+  [./u8]
+  [../]
+  [./u9]
+  [../]
+  [./u10]
+  [../]
+  [./u11]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u0]
+    type = Diffusion
+    variable = u0
+  [../]
+  [./dt_u0]
+    type = TimeDerivative
+    variable = u0
+  [../]
+  [./diff_u1]
+    type = Diffusion
+    variable = u1
+  [../]
+  [./dt_u1]
+    type = TimeDerivative
+    variable = u1
+  [../]
+  [./force_u1]
+    type = CoupledForce
+    variable = u1
+    v = u0
+  [../]
+  [./diff_u2]
+    type = Diffusion
+    variable = u2
+  [../]
+  [./dt_u2]
+    type = TimeDerivative
+    variable = u2
+  [../]
+  [./force_u2]
+    type = CoupledForce
+    variable = u2
+    v = u1
+  [../]
+  [./diff_u3]
+    type = Diffusion
+    variable = u3
+  [../]
+  [./dt_u3]
+    type = TimeDerivative
+    variable = u3
+  [../]
+  [./force_u3]
+    type = CoupledForce
+    variable = u3
+    v = u2
+  [../]
+  [./diff_u4]
+    type = Diffusion
+    variable = u4
+  [../]
+  [./dt_u4]
+    type = TimeDerivative
+    variable = u4
+  [../]
+  [./force_u4]
+    type = CoupledForce
+    variable = u4
+    v = u3
+  [../]
+  [./diff_u5]
+    type = Diffusion
+    variable = u5
+  [../]
+  [./dt_u5]
+    type = TimeDerivative
+    variable = u5
+  [../]
+  [./force_u5]
+    type = CoupledForce
+    variable = u5
+    v = u4
+  [../]
+  [./diff_u6]
+    type = Diffusion
+    variable = u6
+  [../]
+  [./dt_u6]
+    type = TimeDerivative
+    variable = u6
+  [../]
+  [./force_u6]
+    type = CoupledForce
+    variable = u6
+    v = u5
+  [../]
+  [./diff_u7]
+    type = Diffusion
+    variable = u7
+  [../]
+  [./dt_u7]
+    type = TimeDerivative
+    variable = u7
+  [../]
+  [./force_u7]
+    type = CoupledForce
+    variable = u7
+    v = u6
+  [../]
+  [./diff_u8]
+    type = Diffusion
+    variable = u8
+  [../]
+  [./dt_u8]
+    type = TimeDerivative
+    variable = u8
+  [../]
+  [./force_u8]
+    type = CoupledForce
+    variable = u8
+    v = u7
+  [../]
+  [./diff_u9]
+    type = Diffusion
+    variable = u9
+  [../]
+  [./dt_u9]
+    type = TimeDerivative
+    variable = u9
+  [../]
+  [./force_u9]
+    type = CoupledForce
+    variable = u9
+    v = u8
+  [../]
+  [./diff_u10]
+    type = Diffusion
+    variable = u10
+  [../]
+  [./dt_u10]
+    type = TimeDerivative
+    variable = u10
+  [../]
+  [./force_u10]
+    type = CoupledForce
+    variable = u10
+    v = u9
+  [../]
+  [./diff_u11]
+    type = Diffusion
+    variable = u11
+  [../]
+  [./dt_u11]
+    type = TimeDerivative
+    variable = u11
+  [../]
+  [./force_u11]
+    type = CoupledForce
+    variable = u11
+    v = u10
+  [../]
+[]
+
+[BCs]
+  [./left_u0]
+    type = DirichletBC
+    variable = u0
+    boundary = left
+    value = 0
+  [../]
+  [./left_u1]
+    type = DirichletBC
+    variable = u1
+    boundary = left
+    value = 0
+  [../]
+  [./left_u2]
+    type = DirichletBC
+    variable = u2
+    boundary = left
+    value = 0
+  [../]
+  [./left_u3]
+    type = DirichletBC
+    variable = u3
+    boundary = left
+    value = 0
+  [../]
+  [./left_u4]
+    type = DirichletBC
+    variable = u4
+    boundary = left
+    value = 0
+  [../]
+  [./left_u5]
+    type = DirichletBC
+    variable = u5
+    boundary = left
+    value = 0
+  [../]
+  [./left_u6]
+    type = DirichletBC
+    variable = u6
+    boundary = left
+    value = 0
+  [../]
+  [./left_u7]
+    type = DirichletBC
+    variable = u7
+    boundary = left
+    value = 0
+  [../]
+  [./left_u8]
+    type = DirichletBC
+    variable = u8
+    boundary = left
+    value = 0
+  [../]
+  [./left_u9]
+    type = DirichletBC
+    variable = u9
+    boundary = left
+    value = 0
+  [../]
+  [./left_u10]
+    type = DirichletBC
+    variable = u10
+    boundary = left
+    value = 0
+  [../]
+  [./left_u11]
+    type = DirichletBC
+    variable = u11
+    boundary = left
+    value = 0
+  [../]
+  [./right_u0]
+    type = DirichletBC
+    variable = u0
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 0.1
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'jacobi'
+  l_max_its = 10
+  nl_max_its = 2
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
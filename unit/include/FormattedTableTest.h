@@ -0,0 +1,50 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FORMATTEDTABLETEST_H
+#define FORMATTEDTABLETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+#include <string>
+
+class FormattedTable;
+
+class FormattedTableTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( FormattedTableTest );
+
+  CPPUNIT_TEST( streamCSV );
+  CPPUNIT_TEST( streamCSVNewColumn );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void streamCSV();
+  void streamCSVNewColumn();
+
+private:
+  /**
+   * Writes the same rows to a CSV file from a table keeping every row in memory and from a table
+   * keeping at most max_rows, the "b" column only appears in row new_column_row.
+   * Returns true if the two files are identical.
+   */
+  bool compareStreamed(unsigned int max_rows, unsigned int n_rows, unsigned int new_column_row);
+
+  /// Reads a whole file
+  std::string readFile(const std::string & file_name);
+};
+
+#endif  // FORMATTEDTABLETEST_H
@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef RANGEALLOCATORTEST_H
+#define RANGEALLOCATORTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class RangeAllocatorTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( RangeAllocatorTest );
+
+  CPPUNIT_TEST( allocate );
+  CPPUNIT_TEST( release );
+  CPPUNIT_TEST( reuse );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void allocate();
+  void release();
+  void reuse();
+};
+
+#endif  // RANGEALLOCATORTEST_H